@@ -0,0 +1,126 @@
+/**
+ * @file workspace.h
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief Contains workspace_t definition and functions for allocation of temporary memory from it.
+ * @date 2024-05-20
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#ifndef __MEMORY_WORKSPACE_H__
+#define __MEMORY_WORKSPACE_H__
+
+#include <stddef.h>
+
+#include "seq.h"
+
+/**
+ * @brief Alignment of memory allocated from workspace (cache line size).
+ */
+#define WORKSPACE_ALIGNMENT 64
+
+/**
+ * @brief Minimal size of workspace block.
+ */
+#define WORKSPACE_MIN_BLOCK_SIZE 4096
+
+/**
+ * @brief Block of workspace memory, its data follows the header.
+ */
+typedef struct workspace_block {
+    /**
+     * @brief Previous block or NULL.
+     */
+    struct workspace_block* prev;
+
+    /**
+     * @brief Number of bytes taken in all previous blocks when the block was created.
+     */
+    size_t base;
+
+    /**
+     * @brief Block data size.
+     */
+    size_t size;
+
+    /**
+     * @brief Number of bytes taken in the block.
+     */
+    size_t used;
+} workspace_block_t;
+
+/**
+ * @brief Workspace data type: stack of temporary memory that grows on demand and is reused.
+ * @details Memory is taken from the top block, a new block is added when it is exhausted. When all memory is released,
+ * blocks are replaced with one block of the peak size, so a sequence of calls with the same memory requirements
+ * makes no allocations after the first one.
+ */
+typedef struct {
+    /**
+     * @brief Top block or NULL.
+     */
+    workspace_block_t* top;
+
+    /**
+     * @brief Number of bytes taken.
+     */
+    size_t used;
+
+    /**
+     * @brief Maximal number of bytes taken at once.
+     */
+    size_t peak;
+} workspace_t;
+
+/**
+ * @brief Create workspace, no memory is allocated until it is requested.
+ *
+ * @return pointer to created workspace on success and NULL otherwise.
+ */
+workspace_t* workspace_create();
+
+/**
+ * @brief Destroy workspace.
+ *
+ * @param ws workspace.
+ */
+void workspace_destroy(workspace_t* ws);
+
+/**
+ * @brief Take memory from workspace.
+ * @details Memory is aligned by WORKSPACE_ALIGNMENT and is not initialized.
+ *
+ * @param ws workspace.
+ * @param size size in bytes.
+ * @return pointer to memory on success and NULL on memory allocation error.
+ */
+void* workspace_alloc(workspace_t* ws, size_t size);
+
+/**
+ * @brief Take memory for a symbol sequence from workspace.
+ * @details Symbols data is not initialized.
+ *
+ * @param ws workspace.
+ * @param length sequence length.
+ * @param symbol_size symbol size.
+ * @return pointer to sequence on success and NULL on memory allocation error.
+ */
+symbol_seq_t* workspace_alloc_seq(workspace_t* ws, size_t length, size_t symbol_size);
+
+/**
+ * @brief Get the current top of workspace to release all memory taken after it by workspace_release(...).
+ *
+ * @param ws workspace.
+ * @return workspace top.
+ */
+size_t workspace_mark(const workspace_t* ws);
+
+/**
+ * @brief Release all memory taken after the given top of workspace.
+ *
+ * @param ws workspace.
+ * @param mark workspace top returned by workspace_mark(...).
+ */
+void workspace_release(workspace_t* ws, size_t mark);
+
+#endif
@@ -5,6 +5,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "gf256.h"
 #include <memory/symbol.h>
 
 #define ID_NONE 0xffu
@@ -66,8 +67,8 @@ bool equation_is_zero(equation_t* eq);
  */
 bool equation_has_one_id(equation_t* full_symbol);
 
-void equation_multiply(equation_t* eq, uint8_t coef, uint8_t** mul_table);
+void equation_multiply(equation_t* eq, uint8_t coef, uint8_t** mul_table, const gf256_kernels_t* kernels);
 
-int equation_add(equation_t* eq1, equation_t* eq2);
+int equation_add(equation_t* eq1, equation_t* eq2, const gf256_kernels_t* kernels);
 
 #endif
\ No newline at end of file
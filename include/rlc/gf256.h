@@ -12,8 +12,28 @@
 
 #include <stdint.h>
 
+#include <util/cpu.h>
+
+/**
+ * @brief Symbol arithmetic kernels of a certain instruction set tier.
+ */
+typedef struct {
+    cpu_tier_t tier;
+    void (*symbol_add_scaled)(void* symbol1, uint8_t coef, const void* symbol2, uint32_t symbol_size, uint8_t** mul);
+    void (*symbol_mul)(void* symbol1, uint8_t coef, uint32_t symbol_size, uint8_t** mul);
+    void (*symbol_add)(void* symbol1, const void* symbol2, uint32_t symbol_size);
+} gf256_kernels_t;
+
 void gf256_init();
 
+/**
+ * @brief Select symbol arithmetic kernels of a given instruction set tier.
+ *
+ * @param kernels where to place the result.
+ * @param tier instruction set tier (must be supported by CPU).
+ */
+void gf256_select_kernels(gf256_kernels_t* kernels, cpu_tier_t tier);
+
 void assign_mul(uint8_t** array);
 
 void assign_inv(uint8_t* array);
@@ -0,0 +1,44 @@
+/**
+ * @file gf256_simd.h
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief Contains SIMD kernels for symbol arithmetic in a Galois field of size 256.
+ * @details Kernels are compiled for x86 only and must be called only if CPU supports the corresponding instruction set
+ * (see util/cpu.h). Signatures are the same as of scalar functions from rlc/gf256.h.
+ * @date 2024-03-14
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#ifndef __RLC_GF256_SIMD_H__
+#define __RLC_GF256_SIMD_H__
+
+#include <stdint.h>
+
+#include <util/cpu.h>
+
+#ifdef CPU_X86
+
+void gf256_symbol_add_scaled_ssse3(void* symbol1, uint8_t coef, const void* symbol2, uint32_t symbol_size,
+                                   uint8_t** mul);
+
+void gf256_symbol_mul_ssse3(void* symbol1, uint8_t coef, uint32_t symbol_size, uint8_t** mul);
+
+void gf256_symbol_add_ssse3(void* symbol1, const void* symbol2, uint32_t symbol_size);
+
+void gf256_symbol_add_scaled_avx2(void* symbol1, uint8_t coef, const void* symbol2, uint32_t symbol_size,
+                                  uint8_t** mul);
+
+void gf256_symbol_mul_avx2(void* symbol1, uint8_t coef, uint32_t symbol_size, uint8_t** mul);
+
+void gf256_symbol_add_avx2(void* symbol1, const void* symbol2, uint32_t symbol_size);
+
+void gf256_symbol_add_scaled_avx512bw(void* symbol1, uint8_t coef, const void* symbol2, uint32_t symbol_size,
+                                      uint8_t** mul);
+
+void gf256_symbol_mul_avx512bw(void* symbol1, uint8_t coef, uint32_t symbol_size, uint8_t** mul);
+
+void gf256_symbol_add_avx512bw(void* symbol1, const void* symbol2, uint32_t symbol_size);
+
+#endif
+
+#endif
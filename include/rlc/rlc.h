@@ -12,16 +12,19 @@
 
 #include <stdbool.h>
 
+#include "gf256.h"
 #include <memory/seq.h>
 
 typedef struct {
     uint32_t current_repair_symbol;
     uint8_t* inv_table;
     uint8_t** mul_table;
+    gf256_kernels_t kernels;
 } RLC_t;
 
 /**
  * @brief Create context object.
+ * @details Symbol arithmetic kernels are selected by cpu_select_tier().
  *
  * @return pointer to context object or NULL if error occured.
  */
@@ -15,7 +15,8 @@ typedef struct {
 
 bool system_set_bounds(system_t* system, uint16_t first, uint16_t last);
 
-int system_add_with_elimination(system_t* system, equation_t* eq, uint8_t* inv_table, uint8_t** mul_table, int* decoded,
-                                equation_t** removed, int* used_in_system);
+int system_add_with_elimination(system_t* system, equation_t* eq, uint8_t* inv_table, uint8_t** mul_table,
+                                const gf256_kernels_t* kernels, int* decoded, equation_t** removed,
+                                int* used_in_system);
 
 #endif
\ No newline at end of file
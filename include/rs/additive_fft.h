@@ -0,0 +1,96 @@
+/**
+ * @file additive_fft.h
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief Contains additive FFT over GF(65536) in the novel polynomial basis (Lin, Chung, Han).
+ * @details Evaluation points are elements of GF(65536) in the Cantor basis \f$v_0, \dots, v_{15}\f$ (\f$v_0 = 1\f$,
+ * \f$v_i^2 + v_i = v_{i-1}\f$): \f$\omega_j = \sum_i j_i v_i\f$, where \f$j_i\f$ - i-th bit of j. Subspace polynomials
+ * of the Cantor basis \f$s_0(x) = x\f$, \f$s_i(x) = s_{i-1}(x)^2 + s_{i-1}(x)\f$ vanish on \f$\omega_0, \dots,
+ * \omega_{2^i-1}\f$, are linear, \f$s_i(v_i) = 1\f$ and \f$s_i'(x) = 1\f$. Novel basis polynomials are
+ * \f$X_j(x) = \prod_i s_i(x)^{j_i}\f$, \f$\deg X_j = j\f$.\n
+ * Transforms of length \f$2^m\f$ take \f$m 2^{m-1}\f$ butterflies, each of them is one symbol multiplication by a
+ * constant and two symbol additions.
+ * @date 2024-04-02
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#ifndef __REED_SOLOMON_ADDITIVE_FFT_H__
+#define __REED_SOLOMON_ADDITIVE_FFT_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "gf65536.h"
+#include <memory/seq.h>
+#include <memory/workspace.h>
+
+/**
+ * @brief Number of Cantor basis elements of GF(65536).
+ */
+#define AFFT_BASIS_SIZE 16
+
+/**
+ * @brief Maximal length of additive FFT (number of evaluation points).
+ */
+#define AFFT_MAX_LENGTH GF_FIELD_SIZE
+
+/**
+ * @brief Get evaluation point of additive FFT.
+ *
+ * @param idx point index.
+ * @return \f$\omega_{idx}\f$.
+ * @warning pre: idx < AFFT_MAX_LENGTH
+ */
+element_t afft_get_point(uint32_t idx);
+
+/**
+ * @brief Evaluate polynomial given in novel basis at consecutive points: \f$F_j = f(\omega_{offset + j})\f$.
+ * @details Transform is computed in place, f[j] - coefficient of \f$X_j\f$ is replaced by \f$F_j\f$.
+ *
+ * @param gf Galois field data.
+ * @param f polynomial coefficients, its length is a power of 2.
+ * @param offset index of the first point.
+ * @warning pre: offset is divisible by f->length and offset + f->length <= AFFT_MAX_LENGTH
+ */
+void afft_transform(GF_t* gf, symbol_seq_t* f, uint32_t offset);
+
+/**
+ * @brief Interpolate polynomial in novel basis by its values at consecutive points. Inverse of afft_transform(...).
+ *
+ * @param gf Galois field data.
+ * @param f polynomial values, its length is a power of 2.
+ * @param offset index of the first point.
+ * @warning pre: offset is divisible by f->length and offset + f->length <= AFFT_MAX_LENGTH
+ */
+void afft_inverse_transform(GF_t* gf, symbol_seq_t* f, uint32_t offset);
+
+/**
+ * @brief Add formal derivative to polynomial given in novel basis: \f$f(x) \leftarrow f(x) + f'(x)\f$.
+ * @details \f$X_j' = \sum_{i: j_i = 1} X_{j - 2^i}\f$, so the derivative needs symbol additions only. Values of the
+ * result and \f$f'\f$ are equal at roots of f.
+ *
+ * @param gf Galois field data.
+ * @param f polynomial coefficients, its length is a power of 2.
+ */
+void afft_add_derivative(GF_t* gf, symbol_seq_t* f);
+
+/**
+ * @brief Compute logarithms of values of erasure locator polynomial \f$\Lambda(x) = \prod_{e \in E} (x + \omega_e)\f$
+ * and its derivative.
+ * @details Logarithms of \f$\Lambda(\omega_j) = \prod_{e \in E} (\omega_j + \omega_e)\f$ form XOR convolution of the
+ * erasure indicator with \f$\log \omega_x\f$, so they are computed in O(n log n) by fast Walsh-Hadamard transform
+ * modulo N. With \f$\log 0\f$ taken as 0, the same sum for \f$j \in E\f$ is the logarithm of
+ * \f$\Lambda'(\omega_j) = \prod_{e \in E, e \neq j} (\omega_j + \omega_e)\f$.
+ *
+ * @param gf Galois field data.
+ * @param ws workspace or NULL (temporary workspace is created).
+ * @param is_erased is_erased[j] indicates that \f$j \in E\f$.
+ * @param n number of points, power of 2.
+ * @param res res[j] - logarithm of \f$\Lambda(\omega_j)\f$ for \f$j \notin E\f$ and of \f$\Lambda'(\omega_j)\f$ for
+ * \f$j \in E\f$.
+ * @return 0 on success, 1 on memory allocation error.
+ * @warning pre: n <= AFFT_MAX_LENGTH
+ */
+int afft_get_locator_logs(GF_t* gf, workspace_t* ws, const bool* is_erased, uint32_t n, uint16_t* res);
+
+#endif
@@ -77,6 +77,16 @@
  */
 #define CC_THRESHOLD_16 255
 
+/**
+ * @brief Number of cyclotomic cosets of sizes less than CC_MAX_COSET_SIZE.
+ */
+#define CC_SMALL_COSETS_CNT (CC_LEADERS_1_CNT + CC_LEADERS_2_CNT + CC_LEADERS_4_CNT + CC_LEADERS_8_CNT)
+
+/**
+ * @brief Modeled cost of symbol multiplication by a constant in symbol additions (see CC_SELECTION_COST).
+ */
+#define CC_COST_MUL 4
+
 /**
  * @brief Next cyclotomic coset element.
  * @details \f$s_{i+1} = \equiv s_i * 2 \mod N\f$
@@ -94,6 +104,33 @@ typedef struct {
     uint8_t size;
 } coset_t;
 
+/**
+ * @brief Strategy of selection of information and repair symbol cosets.
+ * @details Positions of symbols depend on the strategy, so symbols have to be encoded and decoded with the same one.
+ */
+typedef enum {
+    /**
+     * @brief The largest cosets first: repair symbols take cosets of size 16 while more than 255 positions are left,
+     * then cosets of smaller sizes, information symbols take the rest in the same way.
+     */
+    CC_SELECTION_GREEDY = 0,
+
+    /**
+     * @brief Cosets of each size are split between repair and information symbols so that modeled cost of coding is
+     * minimal.
+     * @details Model counts symbol additions (a multiplication costs CC_COST_MUL additions) of the stages that depend
+     * on the selection, for one encoding and one decoding of r erased symbols:\n
+     * - each repair coset of size m: r * a(m) additions of expansion stage and p(m) multiplications of final stage of
+     * the repair FFT, where a(m) - average number of nonzero normal basis coefficients of a subfield element and p(m) -
+     * number of products of the final stage (9, 27 and 81 for convolutions of sizes 4, 8 and 16);\n
+     * - each information coset of size m: r * a(m) additions and m multiplications of restoration FFT, if any of its
+     * symbols is erased, which happens with probability about min(1, m * r / (k + r)).\n
+     * Small cosets have cheaper final stage and are rarely touched by erasures, the choice between them is made by
+     * exhaustive search over their counts (cosets of size 16 fill the rest).
+     */
+    CC_SELECTION_COST = 1,
+} cc_selection_t;
+
 /**
  * @brief Cyclotomic cosets over GF(2) modulo N pre-computed data.
  */
@@ -101,19 +138,19 @@ typedef struct {
     /**
      * @brief Leaders of cyclotomic cosets.
      * @details leaders[i] - leaders of cyclotomic cosets of size \f$2^i\f$.\n
-     * All members are pointers to different parts of one allocated memory
-     * fragment. leaders[0] - pointer to the beginning of this fragment.
+     * All members are pointers to different parts of tables_cc_leaders (see rs/tables.h).
      */
-    uint16_t* leaders[CC_COSET_SIZES_CNT];
+    const uint16_t* leaders[CC_COSET_SIZES_CNT];
 
     /**
-     * @brief .leaders memory.
+     * @brief Strategy of cc_select_cosets(...).
      */
-    uint16_t _leaders_memory[CC_COSETS_CNT];
+    cc_selection_t selection;
 } CC_t;
 
 /**
  * @brief Create cyclotomic cosets data structure.
+ * @details CC_SELECTION_GREEDY strategy is selected.
  *
  * @return pointer to created cyclotomic cosets data structure on success and NULL otherwise.
  */
@@ -134,8 +171,17 @@ void cc_destroy(CC_t* cc);
  */
 uint8_t cc_get_coset_size(uint16_t leader);
 
+/**
+ * @brief Select strategy of cc_select_cosets(...).
+ *
+ * @param cc cyclotomic cosets data.
+ * @param selection strategy.
+ */
+void cc_set_selection(CC_t* cc, cc_selection_t selection);
+
 /**
  * @brief Estimate upper limits on the number of cyclotomic cosets that will be selected by cc_select_cosets(...).
+ * @details Limits hold for all strategies.
  *
  * @param k number of information symbols.
  * @param r number of repair symbols.
@@ -147,6 +193,8 @@ void cc_estimate_cosets_cnt(uint16_t k, uint16_t r, uint16_t* inf_max_cnt, uint1
 /**
  * @brief Select cyclotomic cosets over GF(2) modulo N that form information and repair symbol positions in a virtual
  * codeword.
+ * @details Selection depends on k, r and the strategy only. Repair cosets contain exactly r positions, the last
+ * information coset may contain more positions than needed.
  *
  * @param cc cyclotomic cosets data.
  * @param k number of information symbols.
@@ -15,6 +15,41 @@
 #include "gf65536.h"
 #include <memory/seq.h>
 #include <memory/symbol.h>
+#include <memory/workspace.h>
+#include <util/pool.h>
+
+/**
+ * @brief Maximal number of cyclotomic cosets expanded in one pass over the input sequence by cyclotomic FFT.
+ */
+#define FFT_CYCL_COSETS_GROUP_SIZE 8
+
+/**
+ * @brief Width in bytes of symbol tiles processed at once by cyclotomic FFT.
+ * @details Tiles of accumulators of all cosets of a group should fit into L2 cache, and tiles should be long enough for
+ * hardware prefetching of input symbols.
+ */
+#define FFT_CYCL_TILE_SIZE 2048
+
+/**
+ * @brief Number of input symbols combined by the Four-Russians expansion stage of cyclotomic FFT.
+ * @details XORs of all subsets of combined inputs are computed once, and every accumulator is updated by one of them.
+ */
+#define FFT_CYCL_COMBINED_INPUTS_CNT 4
+
+/**
+ * @brief Minimal number of accumulators of a cosets group for which input symbols are combined.
+ * @details Computation of subset XORs costs 11 symbol additions per 4 inputs, so it pays off for groups with many
+ * accumulators only.
+ */
+#define FFT_CYCL_COMBINE_MIN_ACCUMULATORS 16
+
+/**
+ * @brief Minimal size of cyclotomic coset for which the final stage of cyclotomic FFT is computed by the short cyclic
+ * convolution algorithm (see gf_normal_basis_convolution(...)).
+ * @details Convolution computes all elements of a coset, so it is used only when direct computation of required
+ * elements takes at least as many multiplications.
+ */
+#define FFT_CYCL_CONVOLUTION_MIN_COSET_SIZE 4
 
 /**
  * @brief Compute a given number of first components of Discrete Fourier transform of a given sequence.
@@ -40,6 +75,24 @@ void fft_transform(GF_t* gf, const symbol_seq_t* f, const uint16_t* positions, s
  */
 int fft_transform_cycl(GF_t* gf, const symbol_seq_t* f, const uint16_t* positions, symbol_seq_t* res);
 
+/**
+ * @brief Compute a given number of first components of Discrete Fourier transform of a given sequence using cyclotomic
+ * FFT algorithm on all threads of thread pool.
+ * @details Cyclotomic cosets write disjoint sets of components, so their groups are divided across threads. Temporary
+ * memory of all threads is taken from workspace, so calls with the same parameters make no allocations once the
+ * workspace has grown.
+ *
+ * @param gf Galois field data.
+ * @param pool thread pool or NULL (the calling thread only).
+ * @param ws workspace or NULL (temporary memory is allocated by the call).
+ * @param f sequence coefficients.
+ * @param positions sequence coefficients indices.
+ * @param res where to place the result.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+int fft_transform_cycl_parallel(GF_t* gf, pool_t* pool, workspace_t* ws, const symbol_seq_t* f,
+                                const uint16_t* positions, symbol_seq_t* res);
+
 /**
  * @brief Compute some components of Discrete Fourier transform of a given sequence.
  * @details \f$\tilde{\mathcal{F}}_{\Omega, d}(f)\f$ - computes \f$F_j = f(a^{-j})\f$, \f$j \in \Omega\f$ for any
@@ -65,4 +118,74 @@ void fft_partial_transform(GF_t* gf, const symbol_seq_t* f, const uint16_t* comp
 int fft_partial_transform_cycl(GF_t* gf, const symbol_seq_t* f, const coset_t* cosets, uint16_t cosets_cnt,
                                symbol_seq_t* res);
 
-#endif
\ No newline at end of file
+/**
+ * @brief Compute some components of Discrete Fourier transform of a given sequence using cyclotomic FFT algorithm on
+ * all threads of thread pool.
+ * @details Cyclotomic cosets write disjoint sets of components, so their groups are divided across threads. Components
+ * can be multiplied by scale factors: \f$res_i = s_i F_j\f$. Scale factors are folded into the constants of the final
+ * stage, so scaled components are written once.
+ *
+ * @param gf Galois field data.
+ * @param pool thread pool or NULL (the calling thread only).
+ * @param ws workspace or NULL (see fft_transform_cycl_parallel(...)).
+ * @param f sequence coefficients.
+ * @param cosets cyclotomic cosets that forms negative components to be computed.
+ * @param cosets_cnt number of cyclotomic cosets.
+ * @param scales scale factors of res symbols or NULL (no scaling).
+ * @param res where to place the result.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+int fft_partial_transform_cycl_parallel(GF_t* gf, pool_t* pool, workspace_t* ws, const symbol_seq_t* f,
+                                        const coset_t* cosets, uint16_t cosets_cnt, const element_t* scales,
+                                        symbol_seq_t* res);
+
+/**
+ * @brief Compute arbitrary components of Discrete Fourier transform of a given sequence using cyclotomic FFT algorithm.
+ * @details Computes \f$F_j = f(a^{-j})\f$, \f$j \in \Omega\f$ like fft_partial_transform(...). Each cyclotomic
+ * coset that contains any of components is transformed as a whole, extra components are discarded.
+ *
+ * @param gf Galois field data.
+ * @param f sequence coefficients.
+ * @param components different negative components of the discrete Fourier transform to be computed.
+ * @param res where to place the result.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+int fft_partial_transform_cycl_components(GF_t* gf, const symbol_seq_t* f, const uint16_t* components,
+                                          symbol_seq_t* res);
+
+/**
+ * @brief Compute arbitrary components of Discrete Fourier transform of a given sequence using cyclotomic FFT algorithm
+ * on all threads of thread pool.
+ * @details Components can be multiplied by scale factors like in fft_partial_transform_cycl_parallel(...).
+ *
+ * @param gf Galois field data.
+ * @param pool thread pool or NULL (the calling thread only).
+ * @param ws workspace or NULL (see fft_transform_cycl_parallel(...)).
+ * @param f sequence coefficients.
+ * @param components different negative components of the discrete Fourier transform to be computed.
+ * @param scales scale factors of res symbols or NULL (no scaling).
+ * @param res where to place the result.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+int fft_partial_transform_cycl_components_parallel(GF_t* gf, pool_t* pool, workspace_t* ws, const symbol_seq_t* f,
+                                                   const uint16_t* components, const element_t* scales,
+                                                   symbol_seq_t* res);
+
+/**
+ * @brief Compute logarithms of values of locator polynomial \f$\Lambda(x) = \prod_{e \in E} (1 + \alpha^e x)\f$ at
+ * all points \f$\alpha^{-j}\f$ and of its derivative at its roots.
+ * @details Logarithms of \f$\prod_{e \in E, e \neq j} (1 + \alpha^{e-j})\f$ form cyclic convolution of the positions
+ * indicator with Zech logarithms \f$\log (1 + \alpha^d)\f$, so they are computed in O(N log N) by number theoretic
+ * transform. The product is \f$\Lambda(\alpha^{-j})\f$ for \f$j \notin E\f$ and \f$\alpha^{-j} \Lambda'(\alpha^{-j})\f$
+ * for \f$j \in E\f$.
+ *
+ * @param gf Galois field data.
+ * @param ws workspace or NULL (see fft_transform_cycl_parallel(...)).
+ * @param positions different positions E.
+ * @param positions_cnt number of positions.
+ * @param res where to place N logarithms.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+int fft_get_locator_logs(GF_t* gf, workspace_t* ws, const uint16_t* positions, uint16_t positions_cnt, uint16_t* res);
+
+#endif
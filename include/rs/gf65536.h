@@ -10,10 +10,12 @@
 #ifndef __REED_SOLOMON_GF65536_H__
 #define __REED_SOLOMON_GF65536_H__
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "cyclotomic_coset.h"
 #include "prelude.h"
+#include <util/cpu.h>
 
 /**
  * @brief Galois field size. Equal to (N + 1).
@@ -31,6 +33,44 @@
  */
 #define GF_NORMAL_BASES_ELEMENTS 31
 
+/**
+ * @brief Number of elements in normal basis representation tables of all GF(65536) subfields.
+ * @details Sum of multiplicative group orders of subfields: 1 + 3 + 15 + 255 + 65535.
+ */
+#define GF_NORMAL_REPR_ELEMENTS 65809
+
+/**
+ * @brief Power of a primitive element that generates multiplicative group of the subfield GF(2^m).
+ * @details \f$\alpha^d \in GF(2^m)\f$ iff d is divisible by GF_SUBFIELD_GENERATOR_POWER(m).
+ */
+#define GF_SUBFIELD_GENERATOR_POWER(_m) (N / ((1u << (_m)) - 1))
+
+/**
+ * @brief Maximal number of sources processed by one call of multi-source kernel (see gf_madd_multi(...)).
+ */
+#define GF_MADD_MULTI_BATCH_SIZE 16
+
+/**
+ * @brief Number of multiplication tables of short cyclic convolution algorithms for all GF(65536) subfields.
+ * @details Karatsuba algorithm for GF(2^m) uses \f$3^{\log_2 m}\f$ multiplications: 1 + 3 + 9 + 27 + 81.
+ */
+#define GF_NORMAL_BASES_CONVOLUTION_TABLES 121
+
+/**
+ * @brief Maximal number of sources and destinations of a bilinear algorithm (see gf_bilinear_t).
+ */
+#define GF_BILINEAR_MAX_SYMBOLS CC_MAX_COSET_SIZE
+
+/**
+ * @brief Maximal number of multiplications of a bilinear algorithm (see gf_bilinear_t).
+ */
+#define GF_BILINEAR_MAX_PRODUCTS 81
+
+/**
+ * @brief Maximal total number of products added to destinations of a bilinear algorithm (see gf_bilinear_t).
+ */
+#define GF_BILINEAR_MAX_TERMS 625
+
 /**
  * @brief Galois field element type.
  */
@@ -41,6 +81,85 @@ typedef uint16_t element_t;
  */
 typedef uint32_t poly_t;
 
+/**
+ * @brief Multiplication tables of a fixed coefficient used by symbol arithmetic kernels.
+ * @details Which fields are filled depends on the selected instruction set tier (see gf_prepare_coef(...)).\n
+ * SIMD kernels split element into 4 nibbles: \f$e = \sum_{i=0}^{3} v_i \cdot 2^{4i}\f$.
+ * lo[i][v] and hi[i][v] - low and high bytes of \f$coef * (v \cdot 2^{4i})\f$.\n
+ * Scalar kernels split element into 2 bytes: \f$e = v_0 + v_1 \cdot 2^8\f$.
+ * by_low_byte[v] - \f$coef * v\f$, by_high_byte[v] - \f$coef * (v \cdot 2^8)\f$.
+ */
+typedef struct {
+    /**
+     * @brief Low bytes of products.
+     * @details Aligned to the cache line, so that SIMD kernels load lo and hi tables without splitting.
+     */
+    _Alignas(64) uint8_t lo[4][16];
+
+    /**
+     * @brief High bytes of products.
+     */
+    uint8_t hi[4][16];
+
+    /**
+     * @brief Products of coefficient and low byte of element (scalar kernels).
+     */
+    element_t by_low_byte[256];
+
+    /**
+     * @brief Products of coefficient and high byte of element (scalar kernels).
+     */
+    element_t by_high_byte[256];
+
+    /**
+     * @brief Coefficient.
+     */
+    element_t coef;
+} gf_coef_tables_t;
+
+/**
+ * @brief Bilinear algorithm with constant coefficients: linear combinations of sources are multiplied by constants and
+ * the products are summed into destinations.
+ * @details \f$P_k = c_k \sum_{t \in inputs_k} B_t\f$, \f$A_j = \sum_{k \in terms_j} P_k\f$. SIMD kernels keep
+ * sources and products split into low and high bytes, so sums are computed without repacking of elements.
+ */
+typedef struct {
+    /**
+     * @brief Multiplication tables of products constants.
+     */
+    const gf_coef_tables_t* tables;
+
+    /**
+     * @brief inputs[k] - bit mask of sources which sum is multiplied by k-th constant.
+     */
+    uint16_t inputs[GF_BILINEAR_MAX_PRODUCTS];
+
+    /**
+     * @brief Indices of products added to destinations: terms of the 0-th destination, then terms of the 1-st one, etc.
+     */
+    uint8_t terms[GF_BILINEAR_MAX_TERMS];
+
+    /**
+     * @brief terms_cnt[j] - number of products added to j-th destination.
+     */
+    uint8_t terms_cnt[GF_BILINEAR_MAX_SYMBOLS];
+
+    /**
+     * @brief Number of sources.
+     */
+    uint8_t sources_cnt;
+
+    /**
+     * @brief Number of products.
+     */
+    uint8_t products_cnt;
+
+    /**
+     * @brief Number of destinations.
+     */
+    uint8_t destinations_cnt;
+} gf_bilinear_t;
+
 /**
  * @brief Galois field data.
  * @details Field definition: \f$GF(2)[x] / \left<PRIMITIVE\_POLY\right>\f$.\n
@@ -49,36 +168,85 @@ typedef uint32_t poly_t;
 typedef struct {
     /**
      * @brief Primitive element powers. Power can belongs to range [0; 2*N-2];
-     * @details \f$pow\_table_i = \alpha^i\f$
+     * @details \f$pow\_table_i = \alpha^i\f$. Points to tables_pow (see rs/tables.h).
      */
-    element_t pow_table[(N << 1) - 1];
+    const element_t* pow_table;
 
     /**
      * @brief Logarithm to the base of a primitive element.
-     * @details \f$log\_table_e = d\f$ s.t. \f$\alpha^d = e\f$
+     * @details \f$log\_table_e = d\f$ s.t. \f$\alpha^d = e\f$. Points to tables_log (see rs/tables.h).
      */
-    uint16_t log_table[GF_FIELD_SIZE];
+    const uint16_t* log_table;
 
     /**
      * @brief Normal bases of all GF(65536) subfields.
+     * @details Points to tables_normal_bases (see rs/tables.h).
      */
-    element_t normal_bases[GF_NORMAL_BASES_ELEMENTS];
+    const element_t* normal_bases;
 
     /**
      * @brief Coefficients in normal basis of subfields GF(2^m).
      * @details j-th bit of normal_repr_by_subfield[m][d] - j-th coefficient in normal basis of \f$GF(2^m)\f$ subfield
-     * of element \f$\alpha^d\f$.
+     * of element \f$\gamma^d\f$, where \f$\gamma = \alpha^{N / (2^m - 1)}\f$ and \f$d < 2^m - 1\f$.\n
+     * All members are pointers to different parts of tables_normal_repr (see rs/tables.h).
+     */
+    const uint16_t* normal_repr_by_subfield[CC_MAX_COSET_SIZE + 1];
+
+    /**
+     * @brief Multiplication tables of normal bases elements for the selected kernels.
+     * @details Tables of GF(2^m) normal basis are stored twice in a row starting from index 2 * (m - 1), so that any
+     * cyclic shift of the basis is a contiguous array of m tables.
+     */
+    gf_coef_tables_t normal_bases_tables[GF_NORMAL_BASES_ELEMENTS << 1];
+
+    /**
+     * @brief Multiplication tables of short cyclic convolution algorithms constants for the selected kernels.
+     * @details Tables of GF(2), GF(4), ..., GF(65536) go one after another.
+     */
+    gf_coef_tables_t normal_bases_convolution_tables[GF_NORMAL_BASES_CONVOLUTION_TABLES];
+
+    /**
+     * @brief Short cyclic convolution algorithms with normal bases of subfields (see gf_normal_basis_convolution(...)).
+     * @details Algorithm of GF(2^m) has index \f$\log_2 m\f$.
+     */
+    gf_bilinear_t normal_bases_convolutions[CC_COSET_SIZES_CNT];
+
+    /**
+     * @brief Instruction set tier of symbol arithmetic kernels.
      */
-    uint16_t* normal_repr_by_subfield[CC_MAX_COSET_SIZE + 1];
+    cpu_tier_t tier;
 
     /**
-     * @brief .normal_repr_by_subfield memory.
+     * @brief "A += B" kernel.
      */
-    uint16_t _normal_repr_by_subfield_memory[CC_COSET_SIZES_CNT * N];
+    void (*add)(void* a, const void* b, size_t symbol_size);
+
+    /**
+     * @brief "A = c * A" kernel.
+     */
+    void (*mul)(void* a, const gf_coef_tables_t* tables, size_t symbol_size);
+
+    /**
+     * @brief "A += c * B" kernel.
+     */
+    void (*madd)(void* a, const gf_coef_tables_t* tables, const void* b, size_t symbol_size);
+
+    /**
+     * @brief "A += c_0 * B_0 + ... + c_{cnt-1} * B_{cnt-1}" kernel.
+     */
+    void (*madd_multi)(void* a, const gf_coef_tables_t* tables, const void* const* b, uint16_t cnt, size_t symbol_size);
+
+    /**
+     * @brief "A_j = s_j * sum_{k in terms_j} c_k * (sum_{t in inputs_k} B_t)" kernel (see gf_bilinear_t), scale
+     * factors s_j are optional.
+     */
+    void (*bilinear)(void* const* a, const gf_bilinear_t* alg, const gf_coef_tables_t* scales, const void* const* b,
+                     size_t symbol_size);
 } GF_t;
 
 /**
  * @brief Create Galois field data structure.
+ * @details Symbol arithmetic kernels are selected by cpu_select_tier().
  *
  * @return pointer to created Galois field data structure on success and NULL otherwise.
  */
@@ -91,6 +259,16 @@ GF_t* gf_create();
  */
 void gf_destroy(GF_t* gf);
 
+/**
+ * @brief Select symbol arithmetic kernels of a given instruction set tier.
+ * @details Multiplication tables of normal bases elements are rebuilt for the selected kernels.
+ *
+ * @param gf Galois field data.
+ * @param tier instruction set tier.
+ * @warning pre: tier <= cpu_detect_tier()
+ */
+void gf_set_tier(GF_t* gf, cpu_tier_t tier);
+
 /**
  * @brief Return i-th element of the normal basis of the subfield GF(2^m)
  *
@@ -108,10 +286,56 @@ element_t gf_get_normal_basis_element(GF_t* gf, uint8_t m, uint8_t i);
  * @param gf Galois field data.
  * @param m subfield power.
  * @param d primitive element power.
- * @return normal basis representation.
+ * @return normal basis representation (0 if alpha^d doesn't belong to the subfield).
  */
 uint16_t gf_get_normal_repr(GF_t* gf, uint8_t m, uint16_t d);
 
+/**
+ * @brief Return coefficients of gamma^d in normal basis of subfield GF(2^m), where gamma = alpha^(N / (2^m - 1)) -
+ * primitive element of the subfield.
+ * @details Unlike gf_get_normal_repr(...), the lookup touches only 2^m - 1 table entries of the subfield.
+ *
+ * @param gf Galois field data.
+ * @param m subfield power.
+ * @param d subfield primitive element power.
+ * @return normal basis representation.
+ * @warning pre: d < 2^m - 1
+ */
+uint16_t gf_get_normal_repr_reduced(GF_t* gf, uint8_t m, uint16_t d);
+
+/**
+ * @brief Compute "A += beta_{shift} * B_0 + beta_{shift+1} * B_1 + ... + beta_{shift+m-1} * B_{m-1}" expression in
+ * Galois field, where beta_i - i-th (modulo m) element of the normal basis of the subfield GF(2^m).
+ * @details Uses multiplication tables precomputed by gf_set_tier(...).
+ *
+ * @param gf Galois field data.
+ * @param a destination element (result will be placed here).
+ * @param m subfield power.
+ * @param shift index of the normal basis element of the first source.
+ * @param b m source elements.
+ * @param symbol_size symbol size (must be divisible by 2).
+ * @warning pre: shift < m
+ */
+void gf_madd_normal_basis(GF_t* gf, void* a, uint8_t m, uint8_t shift, const void* const* b, size_t symbol_size);
+
+/**
+ * @brief Compute "A_j = s_j * (beta_j * B_0 + beta_{j+1} * B_1 + ... + beta_{j+m-1} * B_{m-1})" expressions in Galois
+ * field for all j in [0; m), where beta_i - i-th (modulo m) element of the normal basis of the subfield GF(2^m).
+ * @details Expressions form a cyclic convolution of the normal basis with reversed sources. It is computed by Karatsuba
+ * algorithm: \f$3^{\log_2 m}\f$ symbol multiplications instead of \f$m^2\f$ (81 instead of 256 for m = 16), sums of
+ * sources and products are computed in registers. Scale factors are applied in registers too, so scaled destinations
+ * are written once. Uses algorithms precomputed by gf_set_tier(...).
+ *
+ * @param gf Galois field data.
+ * @param a m destination elements (result will be placed here).
+ * @param m subfield power.
+ * @param scales m multiplication tables of scale factors s_j (see gf_prepare_coef(...)) or NULL (s_j = 1).
+ * @param b m source elements.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_normal_basis_convolution(GF_t* gf, void* const* a, uint8_t m, const gf_coef_tables_t* scales,
+                                 const void* const* b, size_t symbol_size);
+
 /**
  * @brief Compute multiplication of 2 elements in Galois field.
  * @details Use pre-computed data to optimize computation process:
@@ -136,8 +360,55 @@ element_t gf_mul_ee(GF_t* gf, element_t a, element_t b);
  */
 element_t gf_div_ee(GF_t* gf, element_t a, element_t b);
 
+/**
+ * @brief Compute elementwise multiplication of 2 arrays of elements in Galois field.
+ * @details Zero elements are handled without branches.
+ *
+ * @param gf Galois field data.
+ * @param res where to place the result (may be the same as a or b).
+ * @param a first array.
+ * @param b second array.
+ * @param cnt number of elements.
+ */
+void gf_mul_elements(const GF_t* gf, element_t* res, const element_t* a, const element_t* b, size_t cnt);
+
+/**
+ * @brief Compute inverses of array elements in Galois field.
+ * @details Every inverse costs 2 table lookups: \f$a^{-1} = \alpha^{N - \log a}\f$.
+ *
+ * @param gf Galois field data.
+ * @param res where to place the result (may be the same as a).
+ * @param a array of elements.
+ * @param cnt number of elements.
+ * @warning pre: all elements of a are not 0
+ */
+void gf_inv_elements(const GF_t* gf, element_t* res, const element_t* a, size_t cnt);
+
+/**
+ * @brief Compute consecutive powers of primitive element: \f$res_i = \alpha^{start + i \cdot step}\f$.
+ * @details Exponent is updated incrementally, so neither multiplication nor division is needed.
+ *
+ * @param gf Galois field data.
+ * @param res where to place the result.
+ * @param start exponent of the first element.
+ * @param step exponent increment.
+ * @param cnt number of elements.
+ */
+void gf_pow_elements(const GF_t* gf, element_t* res, uint16_t start, uint16_t step, size_t cnt);
+
+/**
+ * @brief Fill multiplication tables of a given coefficient for the selected kernels.
+ *
+ * @param gf Galois field data.
+ * @param tables where to place the result.
+ * @param coef coefficient.
+ */
+void gf_prepare_coef(const GF_t* gf, gf_coef_tables_t* tables, element_t coef);
+
 /**
  * @brief Compute the sum of 2 elements in Galois field.
+ * @details Kept for callers without field data: it always uses the portable kernel, while gf_add_symbols(...) uses the
+ * kernel of the selected instruction set tier.
  *
  * @param a first element (result will be placed here).
  * @param b second element.
@@ -145,6 +416,16 @@ element_t gf_div_ee(GF_t* gf, element_t a, element_t b);
  */
 void gf_add(void* a, const void* b, size_t symbol_size);
 
+/**
+ * @brief Compute the sum of 2 elements in Galois field by the kernel of the selected instruction set tier.
+ *
+ * @param gf Galois field data.
+ * @param a first element (result will be placed here).
+ * @param b second element.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_add_symbols(const GF_t* gf, void* a, const void* b, size_t symbol_size);
+
 /**
  * @brief Compute multiplication of element and coefficient in Galois field.
  *
@@ -166,4 +447,18 @@ void gf_mul(GF_t* gf, void* a, element_t coef, size_t symbol_size);
  */
 void gf_madd(GF_t* gf, void* a, element_t coef, const void* b, size_t symbol_size);
 
+/**
+ * @brief Compute "A += c_0 * B_0 + ... + c_{cnt-1} * B_{cnt-1}" expression in Galois field.
+ * @details Sources are processed in batches of GF_MADD_MULTI_BATCH_SIZE. Inside a batch each part of A is loaded and
+ * stored only once, so it is faster than cnt calls of gf_madd(...).
+ *
+ * @param gf Galois field data.
+ * @param a destination element (result will be placed here).
+ * @param coefs coefficients.
+ * @param b source elements.
+ * @param cnt number of source elements.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_madd_multi(GF_t* gf, void* a, const element_t* coefs, const void* const* b, uint16_t cnt, size_t symbol_size);
+
 #endif
\ No newline at end of file
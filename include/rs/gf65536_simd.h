@@ -0,0 +1,188 @@
+/**
+ * @file gf65536_simd.h
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief Contains SIMD kernels for symbol arithmetic in a Galois field of size 65536.
+ * @details Kernels use split-nibble multiplication: each element is split into 4 nibbles, and products of the
+ * coefficient and all nibble values are looked up by byte shuffle instructions from gf_coef_tables_t.\n
+ * Kernels are compiled for x86 only and must be called only if CPU supports the corresponding instruction set (see
+ * util/cpu.h).
+ * @date 2024-03-12
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#ifndef __REED_SOLOMON_GF65536_SIMD_H__
+#define __REED_SOLOMON_GF65536_SIMD_H__
+
+#include <stddef.h>
+
+#include "gf65536.h"
+#include <util/cpu.h>
+
+#ifdef CPU_X86
+
+/**
+ * @brief Compute the sum of 2 elements in Galois field using SSSE3 tier instructions.
+ *
+ * @param a first element (result will be placed here).
+ * @param b second element.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_add_ssse3(void* a, const void* b, size_t symbol_size);
+
+/**
+ * @brief Compute multiplication of element and coefficient in Galois field using SSSE3 instructions.
+ *
+ * @param a element (result will be placed here).
+ * @param tables coefficient multiplication tables.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_mul_ssse3(void* a, const gf_coef_tables_t* tables, size_t symbol_size);
+
+/**
+ * @brief Compute "A += c * B" expression in Galois field using SSSE3 instructions.
+ *
+ * @param a first element (result will be placed here).
+ * @param tables coefficient multiplication tables.
+ * @param b second element.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_madd_ssse3(void* a, const gf_coef_tables_t* tables, const void* b, size_t symbol_size);
+
+/**
+ * @brief Compute "A += c_0 * B_0 + ... + c_{cnt-1} * B_{cnt-1}" expression in Galois field using SSSE3
+ * instructions.
+ *
+ * @param a destination element (result will be placed here).
+ * @param tables coefficients multiplication tables.
+ * @param b source elements.
+ * @param cnt number of source elements.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_madd_multi_ssse3(void* a, const gf_coef_tables_t* tables, const void* const* b, uint16_t cnt,
+                         size_t symbol_size);
+
+/**
+ * @brief Compute bilinear algorithm "A_j = s_j * sum_{k in terms_j} c_k * (sum_{t in inputs_k} B_t)" in Galois field
+ * using SSSE3 instructions.
+ *
+ * @param a destination elements (result will be placed here).
+ * @param alg bilinear algorithm.
+ * @param scales multiplication tables of destinations scale factors s_j or NULL (s_j = 1).
+ * @param b source elements.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_bilinear_ssse3(void* const* a, const gf_bilinear_t* alg, const gf_coef_tables_t* scales,
+                       const void* const* b, size_t symbol_size);
+
+/**
+ * @brief Compute the sum of 2 elements in Galois field using AVX2 instructions.
+ *
+ * @param a first element (result will be placed here).
+ * @param b second element.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_add_avx2(void* a, const void* b, size_t symbol_size);
+
+/**
+ * @brief Compute multiplication of element and coefficient in Galois field using AVX2 instructions.
+ *
+ * @param a element (result will be placed here).
+ * @param tables coefficient multiplication tables.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_mul_avx2(void* a, const gf_coef_tables_t* tables, size_t symbol_size);
+
+/**
+ * @brief Compute "A += c * B" expression in Galois field using AVX2 instructions.
+ *
+ * @param a first element (result will be placed here).
+ * @param tables coefficient multiplication tables.
+ * @param b second element.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_madd_avx2(void* a, const gf_coef_tables_t* tables, const void* b, size_t symbol_size);
+
+/**
+ * @brief Compute "A += c_0 * B_0 + ... + c_{cnt-1} * B_{cnt-1}" expression in Galois field using AVX2
+ * instructions.
+ *
+ * @param a destination element (result will be placed here).
+ * @param tables coefficients multiplication tables.
+ * @param b source elements.
+ * @param cnt number of source elements.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_madd_multi_avx2(void* a, const gf_coef_tables_t* tables, const void* const* b, uint16_t cnt,
+                        size_t symbol_size);
+
+/**
+ * @brief Compute bilinear algorithm "A_j = s_j * sum_{k in terms_j} c_k * (sum_{t in inputs_k} B_t)" in Galois field
+ * using AVX2 instructions.
+ *
+ * @param a destination elements (result will be placed here).
+ * @param alg bilinear algorithm.
+ * @param scales multiplication tables of destinations scale factors s_j or NULL (s_j = 1).
+ * @param b source elements.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_bilinear_avx2(void* const* a, const gf_bilinear_t* alg, const gf_coef_tables_t* scales,
+                      const void* const* b, size_t symbol_size);
+
+/**
+ * @brief Compute the sum of 2 elements in Galois field using AVX-512BW instructions.
+ *
+ * @param a first element (result will be placed here).
+ * @param b second element.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_add_avx512bw(void* a, const void* b, size_t symbol_size);
+
+/**
+ * @brief Compute multiplication of element and coefficient in Galois field using AVX-512BW instructions.
+ *
+ * @param a element (result will be placed here).
+ * @param tables coefficient multiplication tables.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_mul_avx512bw(void* a, const gf_coef_tables_t* tables, size_t symbol_size);
+
+/**
+ * @brief Compute "A += c * B" expression in Galois field using AVX-512BW instructions.
+ *
+ * @param a first element (result will be placed here).
+ * @param tables coefficient multiplication tables.
+ * @param b second element.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_madd_avx512bw(void* a, const gf_coef_tables_t* tables, const void* b, size_t symbol_size);
+
+/**
+ * @brief Compute "A += c_0 * B_0 + ... + c_{cnt-1} * B_{cnt-1}" expression in Galois field using AVX-512BW
+ * instructions.
+ *
+ * @param a destination element (result will be placed here).
+ * @param tables coefficients multiplication tables.
+ * @param b source elements.
+ * @param cnt number of source elements.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_madd_multi_avx512bw(void* a, const gf_coef_tables_t* tables, const void* const* b, uint16_t cnt,
+                            size_t symbol_size);
+
+/**
+ * @brief Compute bilinear algorithm "A_j = s_j * sum_{k in terms_j} c_k * (sum_{t in inputs_k} B_t)" in Galois field
+ * using AVX-512BW instructions.
+ *
+ * @param a destination elements (result will be placed here).
+ * @param alg bilinear algorithm.
+ * @param scales multiplication tables of destinations scale factors s_j or NULL (s_j = 1).
+ * @param b source elements.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+void gf_bilinear_avx512bw(void* const* a, const gf_bilinear_t* alg, const gf_coef_tables_t* scales,
+                          const void* const* b, size_t symbol_size);
+
+#endif
+
+#endif
@@ -14,9 +14,12 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "additive_fft.h"
 #include "cyclotomic_coset.h"
 #include "gf65536.h"
 #include <memory/seq.h>
+#include <memory/workspace.h>
+#include <util/pool.h>
 
 /**
  * @brief Maximum number of cyclotomic coset locator polynomial coefficients.
@@ -28,16 +31,175 @@
  */
 #define RS_ERR_CANNOT_RESTORE 100
 
+/**
+ * @brief Width in bytes of symbol stripes processed at once by the evaluator polynomial computation.
+ * @details Smaller stripes keep syndrome and evaluator stripes in cache, larger ones reduce per-call overhead of
+ * symbol arithmetic kernels.
+ */
+#define RS_EVALUATOR_STRIPE_SIZE 1024
+
+/**
+ * @brief Minimal number of evaluator polynomial coefficients for which it is computed by Karatsuba algorithm.
+ * @details Crossover point measured on 1024-byte symbols with random locator coefficients (decoding).
+ */
+#define RS_KARATSUBA_MIN_LEN 192
+
+/**
+ * @brief Minimal number of evaluator polynomial coefficients for which it is computed by Karatsuba algorithm if all
+ * locator coefficients are 0 or 1 (encoding).
+ * @details Schoolbook algorithm skips zero coefficients and replaces multiplications by 1 with additions, so it is
+ * faster up to much larger lengths.
+ */
+#define RS_KARATSUBA_BINARY_MIN_LEN 2048
+
+/**
+ * @brief Maximal number of polynomial coefficients multiplied by schoolbook algorithm at the bottom of Karatsuba
+ * recursion.
+ */
+#define RS_KARATSUBA_BASE_LEN 32
+
+/**
+ * @brief Width in bytes of symbol stripes processed at once by Karatsuba multiplication.
+ * @details Temporary polynomials of Karatsuba algorithm take about (6 * t * RS_KARATSUBA_STRIPE_SIZE) bytes.
+ */
+#define RS_KARATSUBA_STRIPE_SIZE 1024
+
+/**
+ * @brief Minimal number of erasures (or repair symbols of a plan) for which their locator polynomial is computed by
+ * product tree.
+ * @details Subtrees of fewer positions are computed by multiplying by one root factor at a time.
+ */
+#define RS_LOCATOR_TREE_MIN_LEN 8192
+
+/**
+ * @brief Maximal number of coefficients of element polynomials multiplied by schoolbook algorithm at the bottom of
+ * Karatsuba recursion of locator product tree.
+ */
+#define RS_LOCATOR_TREE_BASE_LEN 1024
+
+/**
+ * @brief Minimal locator polynomial degree for which Forney coefficients are computed from logarithms of locator
+ * derivative values given by fft_get_locator_logs(...).
+ * @details The transform takes the same time for any number of erasures, while direct evaluation of the derivative
+ * takes O(t) multiplications per position.
+ */
+#define RS_FORNEY_LOGS_MIN_LEN 3072
+
+/**
+ * @brief Width in bytes of symbol stripes encoded at once by rs_generate_repair_symbols(...).
+ * @details All encoding stages run on one stripe of all symbols before going to the next stripe, so intermediate
+ * polynomials take (2 * r * RS_ENCODE_STRIPE_SIZE) bytes and stay in cache for large symbols.
+ */
+#define RS_ENCODE_STRIPE_SIZE 2048
+
+/**
+ * @brief Width in bytes of symbol stripes processed at once by the additive engine.
+ * @details Transforms pass over stripes of all n symbols of the codeword log(n) times, so smaller stripes keep them in
+ * cache, while larger ones reduce the cost of preparation of multiplication tables for each butterfly block.
+ */
+#define RS_ADDITIVE_STRIPE_SIZE 2048
+
+/**
+ * @brief Name of environment variable that sets number of threads used by context objects created by rs_create().
+ */
+#define RS_THREADS_ENV "RS_THREADS"
+
+/**
+ * @brief Maximal number of threads used by context object.
+ */
+#define RS_MAX_THREADS_CNT 256
+
+/**
+ * @brief Coding engine.
+ * @details RS_ENGINE_CYCLOTOMIC - codewords are components of Discrete Fourier transform over the multiplicative group,
+ * computed by cyclotomic FFT, coding takes O(k * r) symbol operations.\n
+ * RS_ENGINE_ADDITIVE - codewords are values of polynomials at points of an additive subgroup, computed by additive FFT
+ * (see rs/additive_fft.h), coding takes O(n log n) symbol operations, where n < 4 * (k + r) - number of points.\n
+ * Both engines produce MDS codes, but codewords of different engines are different.
+ */
+typedef enum {
+    RS_ENGINE_CYCLOTOMIC = 0,
+    RS_ENGINE_ADDITIVE = 1,
+} rs_engine_t;
+
+/**
+ * @brief Coding plan: data of the cyclotomic engine that depends on code parameters only.
+ * @details Plan is built with the cosets selection strategy of the context, so symbols coded with it have to be coded
+ * with the same strategy.
+ */
+typedef struct {
+    /**
+     * @brief Number of information symbols.
+     */
+    uint16_t k;
+
+    /**
+     * @brief Number of repair symbols.
+     */
+    uint16_t r;
+
+    /**
+     * @brief Cyclotomic cosets that form information symbol positions.
+     */
+    coset_t* inf_cosets;
+
+    /**
+     * @brief Cyclotomic cosets that form repair symbol positions.
+     */
+    coset_t* rep_cosets;
+
+    uint16_t inf_cosets_cnt;
+    uint16_t rep_cosets_cnt;
+
+    /**
+     * @brief Positions of information symbols followed by positions of repair symbols.
+     */
+    uint16_t* positions;
+
+    /**
+     * @brief Repair symbols locator polynomial (r + 1 coefficients).
+     */
+    element_t* rep_locator_poly;
+
+    /**
+     * @brief Forney coefficients of repair symbol positions.
+     */
+    element_t* rep_forney_coefs;
+} rs_plan_t;
+
 /**
  * @brief Context data.
  */
 typedef struct {
     GF_t* gf;
     CC_t* cc;
+    rs_engine_t engine;
+
+    /**
+     * @brief Thread pool of cyclotomic FFT, NULL if the calling thread only is used.
+     */
+    pool_t* pool;
+
+    /**
+     * @brief Plan of the last code parameters coded by rs_generate_repair_symbols(...) or rs_restore_symbols(...), NULL
+     * if there is none.
+     */
+    rs_plan_t* plan;
+
+    /**
+     * @brief Temporary memory of coding calls.
+     */
+    workspace_t* workspace;
+
+    /**
+     * @brief Whether workspace was created by the context (otherwise it is attached by rs_set_workspace(...)).
+     */
+    bool owns_workspace;
 } RS_t;
 
 /**
  * @brief Create context object.
+ * @details Context object uses one thread, unless RS_THREADS_ENV environment variable is set.
  *
  * @return pointer to created context object on success and NULL otherwise.
  */
@@ -50,8 +212,68 @@ RS_t* rs_create();
  */
 void rs_destroy(RS_t* rs);
 
+/**
+ * @brief Set number of threads used by cyclotomic FFT stages of coding.
+ *
+ * @param rs context object.
+ * @param threads_cnt number of threads, including the calling one.
+ * @return 0 on success, 1 on thread pool creation error (previous thread pool is kept).
+ * @warning pre: 0 < threads_cnt <= RS_MAX_THREADS_CNT
+ */
+int rs_set_threads_cnt(RS_t* rs, uint16_t threads_cnt);
+
+/**
+ * @brief Attach workspace used for temporary memory of coding calls instead of the workspace of the context.
+ * @details Workspace grows on demand and is reused, so consecutive calls with the same code parameters make no
+ * allocations. A workspace can be shared by contexts used by the same thread. The caller keeps ownership of the
+ * workspace, it has to outlive the context or be replaced by another one.
+ *
+ * @param rs context object.
+ * @param ws workspace.
+ */
+void rs_set_workspace(RS_t* rs, workspace_t* ws);
+
+/**
+ * @brief Select coding engine. RS_ENGINE_CYCLOTOMIC is selected by rs_create().
+ *
+ * @param rs context object.
+ * @param engine coding engine.
+ */
+void rs_set_engine(RS_t* rs, rs_engine_t engine);
+
+/**
+ * @brief Select strategy of selection of symbol positions of cyclotomic engine. CC_SELECTION_GREEDY is selected by
+ * rs_create().
+ * @details Positions of symbols depend on the strategy, so symbols have to be encoded and decoded with the same one.
+ *
+ * @param rs context object.
+ * @param selection strategy.
+ */
+void rs_set_cosets_selection(RS_t* rs, cc_selection_t selection);
+
+/**
+ * @brief Create coding plan for the given code parameters.
+ * @details Plan can be used by any context object with the same cosets selection strategy.
+ *
+ * @param rs context object.
+ * @param k number of information symbols.
+ * @param r number of repair symbols.
+ * @return pointer to created plan on success and NULL otherwise.
+ * @warning pre: k + r <= N
+ */
+rs_plan_t* rs_plan_create(RS_t* rs, uint16_t k, uint16_t r);
+
+/**
+ * @brief Destroy coding plan.
+ *
+ * @param plan coding plan.
+ */
+void rs_plan_destroy(rs_plan_t* plan);
+
 /**
  * @brief Generate repair symbols for the given information symbols.
+ * @details Plan of the code parameters is kept in the context object, so it is reused by consecutive calls with the
+ * same number of information and repair symbols.
  *
  * @param rs context object.
  * @param inf_symbols information symbols.
@@ -61,7 +283,24 @@ void rs_destroy(RS_t* rs);
 int rs_generate_repair_symbols(RS_t* rs, const symbol_seq_t* inf_symbols, symbol_seq_t* rep_symbols);
 
 /**
- * @brief Restore erased symbols. Assume that rcv_symbols[i] = 0 for erased i.
+ * @brief Generate repair symbols for the given information symbols using coding plan.
+ *
+ * @param rs context object.
+ * @param plan coding plan.
+ * @param inf_symbols information symbols.
+ * @param rep_symbols where to place the result.
+ * @return 0 on success, 1 on memory allocation error.
+ * @warning pre: plan->k == inf_symbols->length and plan->r == rep_symbols->length
+ */
+int rs_plan_generate_repair_symbols(RS_t* rs, const rs_plan_t* plan, const symbol_seq_t* inf_symbols,
+                                    symbol_seq_t* rep_symbols);
+
+/**
+ * @brief Restore erased symbols.
+ * @details Erased symbols are not read, so their content may be arbitrary. Plan of the code parameters is kept in the
+ * context object, as in rs_generate_repair_symbols(...).\n
+ * If no information symbol is erased, the call returns at once. A single erased symbol of cyclotomic engine is
+ * restored as the sum of all received symbols in one pass over them, without the plan.
  *
  * @param rs context object.
  * @param k number of information symbols.
@@ -70,7 +309,24 @@ int rs_generate_repair_symbols(RS_t* rs, const symbol_seq_t* inf_symbols, symbol
  * @param is_erased indicates which symbols has been erased.
  * @param t number of erases.
  * @return 0 on success, 1 on memory allocation error, or RS_ERR_CANNOT_RESTORE.
+ * @warning pre: exactly t elements of is_erased are true
  */
 int rs_restore_symbols(RS_t* rs, uint16_t k, uint16_t r, symbol_seq_t* rcv_symbols, const bool* is_erased, uint16_t t);
 
+/**
+ * @brief Restore erased symbols using coding plan.
+ * @details Erased symbols are not read, so their content may be arbitrary. Trivial erasure patterns are handled like
+ * in rs_restore_symbols(...).
+ *
+ * @param rs context object.
+ * @param plan coding plan.
+ * @param rcv_symbols received symbols, restored symbols will be written here.
+ * @param is_erased indicates which symbols has been erased.
+ * @param t number of erases.
+ * @return 0 on success, 1 on memory allocation error, or RS_ERR_CANNOT_RESTORE.
+ * @warning pre: plan->k + plan->r == rcv_symbols->length and exactly t elements of is_erased are true
+ */
+int rs_plan_restore_symbols(RS_t* rs, const rs_plan_t* plan, symbol_seq_t* rcv_symbols, const bool* is_erased,
+                            uint16_t t);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,60 @@
+/**
+ * @file tables.h
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief Contains tables of Galois field and cyclotomic cosets that are generated at build time.
+ * @details Tables are defined in a source file written by the gen_tables tool (src/rs/gen_tables.c). They are
+ * read-only, so processes using the library share them through the page cache.
+ * @date 2024-03-20
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#ifndef __REED_SOLOMON_TABLES_H__
+#define __REED_SOLOMON_TABLES_H__
+
+#include <stdint.h>
+
+#include "additive_fft.h"
+#include "cyclotomic_coset.h"
+#include "gf65536.h"
+#include "prelude.h"
+
+/**
+ * @brief Primitive element powers. Power can belongs to range [0; 2*N-2].
+ * @details \f$tables\_pow_i = \alpha^i\f$
+ */
+extern const element_t tables_pow[(N << 1) - 1];
+
+/**
+ * @brief Logarithm to the base of a primitive element.
+ * @details \f$tables\_log_e = d\f$ s.t. \f$\alpha^d = e\f$, \f$tables\_log_0 = 0\f$.
+ */
+extern const uint16_t tables_log[GF_FIELD_SIZE];
+
+/**
+ * @brief Normal bases of all GF(65536) subfields.
+ * @details Basis of GF(2^m) starts from index (m - 1).
+ */
+extern const element_t tables_normal_bases[GF_NORMAL_BASES_ELEMENTS];
+
+/**
+ * @brief Coefficients in normal basis of subfields GF(2^m).
+ * @details Tables of subfields GF(2), GF(4), ..., GF(65536) go one after another. Table of GF(2^m) contains
+ * \f$2^m - 1\f$ entries: j-th bit of d-th entry - j-th coefficient in normal basis of element \f$\gamma^d\f$, where
+ * \f$\gamma = \alpha^{N / (2^m - 1)}\f$.
+ */
+extern const uint16_t tables_normal_repr[GF_NORMAL_REPR_ELEMENTS];
+
+/**
+ * @brief Leaders of cyclotomic cosets sorted by coset size and then by value.
+ */
+extern const uint16_t tables_cc_leaders[CC_COSETS_CNT];
+
+/**
+ * @brief Values of subspace polynomials of the Cantor basis at the basis elements.
+ * @details \f$tables\_cantor\_subspace_{i \cdot AFFT\_BASIS\_SIZE + b} = s_i(v_b)\f$ (see rs/additive_fft.h). The
+ * first row is the Cantor basis itself.
+ */
+extern const element_t tables_cantor_subspace[AFFT_BASIS_SIZE * AFFT_BASIS_SIZE];
+
+#endif
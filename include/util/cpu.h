@@ -0,0 +1,64 @@
+/**
+ * @file cpu.h
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief Contains run-time detection of CPU instruction sets used by arithmetic kernels.
+ * @date 2024-03-14
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#ifndef __UTIL_CPU_H__
+#define __UTIL_CPU_H__
+
+/**
+ * @brief Defined if SIMD kernels for x86 instruction sets can be compiled.
+ */
+#if defined(__x86_64__) || defined(__i386__)
+#define CPU_X86
+#endif
+
+/**
+ * @brief Name of environment variable that can force lower instruction set tier.
+ * @details Allowed values: "scalar", "ssse3", "avx2", "avx512bw". Tier that is not supported by CPU is ignored.
+ */
+#define CPU_TIER_ENV "GF_SIMD_TIER"
+
+/**
+ * @brief Instruction set tier. Each tier includes all previous ones.
+ */
+typedef enum {
+    CPU_TIER_SCALAR = 0,
+    CPU_TIER_SSSE3 = 1,
+    CPU_TIER_AVX2 = 2,
+    CPU_TIER_AVX512BW = 3,
+} cpu_tier_t;
+
+/**
+ * @brief Number of instruction set tiers.
+ */
+#define CPU_TIERS_CNT 4
+
+/**
+ * @brief Detect the highest instruction set tier supported by CPU.
+ *
+ * @return instruction set tier.
+ */
+cpu_tier_t cpu_detect_tier();
+
+/**
+ * @brief Select instruction set tier for arithmetic kernels.
+ * @details Return cpu_detect_tier() lowered to the value of CPU_TIER_ENV environment variable if it is set.
+ *
+ * @return instruction set tier.
+ */
+cpu_tier_t cpu_select_tier();
+
+/**
+ * @brief Return name of instruction set tier.
+ *
+ * @param tier instruction set tier.
+ * @return tier name.
+ */
+const char* cpu_tier_name(cpu_tier_t tier);
+
+#endif
@@ -0,0 +1,108 @@
+/**
+ * @file pool.h
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief Contains thread pool that runs one task on several threads at once.
+ * @date 2024-04-09
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#ifndef __UTIL_POOL_H__
+#define __UTIL_POOL_H__
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Thread pool data.
+ * @details The calling thread of pool_run(...) is one of the pool threads, so the pool starts (threads_cnt - 1)
+ * helper threads.
+ */
+typedef struct {
+    /**
+     * @brief Number of threads, including the calling one.
+     */
+    uint16_t threads_cnt;
+
+    /**
+     * @brief Helper threads.
+     */
+    pthread_t* threads;
+
+    /**
+     * @brief Protects all fields below.
+     */
+    pthread_mutex_t mutex;
+
+    /**
+     * @brief Signaled when a new task is started or the pool is stopped.
+     */
+    pthread_cond_t start;
+
+    /**
+     * @brief Signaled when all helper threads have finished the task.
+     */
+    pthread_cond_t done;
+
+    /**
+     * @brief Current task.
+     */
+    void (*task)(void* arg);
+
+    /**
+     * @brief Argument of the current task.
+     */
+    void* arg;
+
+    /**
+     * @brief Number of started tasks.
+     */
+    uint64_t generation;
+
+    /**
+     * @brief Number of helper threads that run the current task.
+     */
+    uint16_t running_cnt;
+
+    /**
+     * @brief Whether helper threads have to exit.
+     */
+    bool stop;
+} pool_t;
+
+/**
+ * @brief Create thread pool.
+ *
+ * @param threads_cnt number of threads, including the calling one.
+ * @return pointer to created thread pool on success and NULL otherwise.
+ * @warning pre: threads_cnt > 0
+ */
+pool_t* pool_create(uint16_t threads_cnt);
+
+/**
+ * @brief Destroy thread pool.
+ *
+ * @param pool thread pool.
+ */
+void pool_destroy(pool_t* pool);
+
+/**
+ * @brief Get number of threads of thread pool.
+ *
+ * @param pool thread pool or NULL.
+ * @return number of threads, including the calling one (1 for NULL).
+ */
+uint16_t pool_get_threads_cnt(const pool_t* pool);
+
+/**
+ * @brief Run task on all threads of thread pool and wait until it is finished by all of them.
+ * @details Task is called once by each thread with the same argument, so it has to divide work by itself.
+ *
+ * @param pool thread pool or NULL (task is called by the calling thread only).
+ * @param task task.
+ * @param arg task argument.
+ */
+void pool_run(pool_t* pool, void (*task)(void* arg), void* arg);
+
+#endif
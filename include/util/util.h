@@ -21,4 +21,9 @@
  */
 #define MIN(_x, _y) (((_x) < (_y)) ? (_x) : (_y))
 
+/**
+ * @brief Maximum of two values.
+ */
+#define MAX(_x, _y) (((_x) > (_y)) ? (_x) : (_y))
+
 #endif
\ No newline at end of file
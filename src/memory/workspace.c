@@ -0,0 +1,140 @@
+/**
+ * @file workspace.c
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief memory/workspace.h implementation.
+ * @date 2024-05-20
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <memory/workspace.h>
+#include <util/util.h>
+
+/**
+ * @brief Round size up to a multiple of WORKSPACE_ALIGNMENT.
+ */
+#define WORKSPACE_ALIGN(_size) (((_size) + WORKSPACE_ALIGNMENT - 1) & ~(size_t)(WORKSPACE_ALIGNMENT - 1))
+
+/**
+ * @brief Size of block header, block data follows it.
+ */
+#define WORKSPACE_HEADER_SIZE WORKSPACE_ALIGN(sizeof(workspace_block_t))
+
+workspace_t* workspace_create() {
+    workspace_t* ws;
+
+    ws = (workspace_t*)malloc(sizeof(workspace_t));
+    if (!ws)
+        return NULL;
+    memset((void*)ws, 0, sizeof(workspace_t));
+
+    return ws;
+}
+
+void workspace_destroy(workspace_t* ws) {
+    assert(ws != NULL);
+
+    while (ws->top) {
+        workspace_block_t* prev = ws->top->prev;
+
+        free(ws->top);
+        ws->top = prev;
+    }
+
+    free(ws);
+}
+
+void* workspace_alloc(workspace_t* ws, size_t size) {
+    assert(ws != NULL);
+
+    workspace_block_t* top = ws->top;
+
+    size = WORKSPACE_ALIGN(size);
+
+    if (!top || top->used + size > top->size) {
+        // the new block is large enough for all memory taken at once so far, so blocks are rarely added
+        size_t block_size = WORKSPACE_ALIGN(MAX(size, MAX(ws->peak, (size_t)WORKSPACE_MIN_BLOCK_SIZE)));
+
+        top = (workspace_block_t*)aligned_alloc(WORKSPACE_ALIGNMENT, WORKSPACE_HEADER_SIZE + block_size);
+        if (!top)
+            return NULL;
+
+        top->prev = ws->top;
+        top->base = ws->used;
+        top->size = block_size;
+        top->used = 0;
+        ws->top = top;
+    }
+
+    void* ptr = (void*)((uint8_t*)top + WORKSPACE_HEADER_SIZE + top->used);
+
+    top->used += size;
+    ws->used += size;
+    ws->peak = MAX(ws->peak, ws->used);
+
+    return ptr;
+}
+
+symbol_seq_t* workspace_alloc_seq(workspace_t* ws, size_t length, size_t symbol_size) {
+    assert(ws != NULL);
+
+    size_t stride = WORKSPACE_ALIGN(symbol_size);
+    symbol_seq_t* seq;
+    symbol_t* symbols;
+    uint8_t* data;
+
+    seq = (symbol_seq_t*)workspace_alloc(ws, sizeof(symbol_seq_t) + length * (sizeof(symbol_t*) + sizeof(symbol_t)));
+    if (!seq)
+        return NULL;
+
+    data = (uint8_t*)workspace_alloc(ws, length * stride);
+    if (!data)
+        return NULL;
+
+    seq->length = length;
+    seq->symbol_size = symbol_size;
+    seq->symbols = (symbol_t**)(seq + 1);
+    symbols = (symbol_t*)(seq->symbols + length);
+
+    for (size_t i = 0; i < length; ++i) {
+        symbols[i].data = data + i * stride;
+        seq->symbols[i] = symbols + i;
+    }
+
+    return seq;
+}
+
+size_t workspace_mark(const workspace_t* ws) {
+    assert(ws != NULL);
+
+    return ws->used;
+}
+
+void workspace_release(workspace_t* ws, size_t mark) {
+    assert(ws != NULL);
+    assert(mark <= ws->used);
+
+    while (ws->top && ws->top->prev && ws->top->base >= mark) {
+        workspace_block_t* prev = ws->top->prev;
+
+        free(ws->top);
+        ws->top = prev;
+    }
+
+    ws->used = mark;
+    if (!ws->top)
+        return;
+
+    ws->top->used = mark - ws->top->base;
+
+    // all memory is released: the only block is replaced with one that fits all requests made so far
+    if (mark == 0 && ws->top->size < ws->peak) {
+        free(ws->top);
+        ws->top = NULL;
+    }
+}
@@ -137,14 +137,14 @@ bool equation_has_one_id(equation_t* full_symbol) {
            (equation_get_min_symbol_id(full_symbol) == equation_get_max_symbol_id(full_symbol));
 }
 
-void equation_multiply(equation_t* eq, uint8_t coef, uint8_t** mul_table) {
+void equation_multiply(equation_t* eq, uint8_t coef, uint8_t** mul_table, const gf256_kernels_t* kernels) {
     // multiply the coefficients of the equation (we can do it with one call)
-    gf256_symbol_mul(eq->coefs, coef, eq->n_coefs, mul_table);
+    kernels->symbol_mul(eq->coefs, coef, eq->n_coefs, mul_table);
     // multiply the constant term of the equation
-    gf256_symbol_mul(eq->constant_term->data, coef, eq->symbol_size, mul_table);
+    kernels->symbol_mul(eq->constant_term->data, coef, eq->symbol_size, mul_table);
 }
 
-static void add_coefs(equation_t* eq1, equation_t* eq2, uint16_t from, uint16_t to) {
+static void add_coefs(equation_t* eq1, equation_t* eq2, uint16_t from, uint16_t to, const gf256_kernels_t* kernels) {
     // from = MAX(from, eq2->constant_term.metadata.first_id);
     // to = MIN(to, repair_symbol_last_id(&eq2->constant_term));
     // uint8_t *eq1_coefs_buffer = &eq1->coefs[from -
@@ -154,10 +154,10 @@ static void add_coefs(equation_t* eq1, equation_t* eq2, uint16_t from, uint16_t
     uint8_t* eq1_coefs_buffer = &eq1->coefs[from];
     uint8_t* eq2_coefs_buffer = &eq2->coefs[from];
 
-    gf256_symbol_add((void*)eq1_coefs_buffer, (void*)eq2_coefs_buffer, MIN(to + 1 - from, eq1->n_protected_symbols));
+    kernels->symbol_add((void*)eq1_coefs_buffer, (void*)eq2_coefs_buffer, MIN(to + 1 - from, eq1->n_protected_symbols));
 }
 
-static void full_symbol_add_base(equation_t* eq1, equation_t* eq2) {
+static void full_symbol_add_base(equation_t* eq1, equation_t* eq2, const gf256_kernels_t* kernels) {
     assert(eq1->constant_term->data != NULL && eq2->constant_term->data != NULL);
 
     //    uint32_t first_coef_index;
@@ -180,18 +180,18 @@ static void full_symbol_add_base(equation_t* eq1, equation_t* eq2) {
             eq1->coefs[i - first_rs_id] = equation_get_coef(eq1, i) ^ equation_get_coef(eq2, i);
         }
     } else {
-        add_coefs(eq1, eq2, eq2->pivot, eq2->last_non_zero_id);
+        add_coefs(eq1, eq2, eq2->pivot, eq2->last_non_zero_id, kernels);
     }
 
     equation_adjust_non_zero_bounds(eq1);
-    gf256_symbol_add((void*)eq1->constant_term->data, (void*)eq2->constant_term->data, eq2->symbol_size);
+    kernels->symbol_add((void*)eq1->constant_term->data, (void*)eq2->constant_term->data, eq2->symbol_size);
 }
 
-int equation_add(equation_t* eq1, equation_t* eq2) {
+int equation_add(equation_t* eq1, equation_t* eq2, const gf256_kernels_t* kernels) {
     // here were a lot of memory magic
 
     // results stored in eq1
-    full_symbol_add_base(eq1, eq2);
+    full_symbol_add_base(eq1, eq2, kernels);
 
     return 0;
 }
@@ -12,6 +12,7 @@
 #include <stdio.h>
 
 #include <rlc/gf256.h>
+#include <rlc/gf256_simd.h>
 
 static bool initialized = false;
 
@@ -113,6 +114,36 @@ void gf256_symbol_add(void* symbol1, const void* symbol2, uint32_t symbol_size)
         *data_1 ^= *data_2;
 }
 
+void gf256_select_kernels(gf256_kernels_t* kernels, cpu_tier_t tier) {
+    kernels->tier = tier;
+
+    switch (tier) {
+#ifdef CPU_X86
+    case CPU_TIER_AVX512BW:
+        kernels->symbol_add_scaled = gf256_symbol_add_scaled_avx512bw;
+        kernels->symbol_mul = gf256_symbol_mul_avx512bw;
+        kernels->symbol_add = gf256_symbol_add_avx512bw;
+        break;
+    case CPU_TIER_AVX2:
+        kernels->symbol_add_scaled = gf256_symbol_add_scaled_avx2;
+        kernels->symbol_mul = gf256_symbol_mul_avx2;
+        kernels->symbol_add = gf256_symbol_add_avx2;
+        break;
+    case CPU_TIER_SSSE3:
+        kernels->symbol_add_scaled = gf256_symbol_add_scaled_ssse3;
+        kernels->symbol_mul = gf256_symbol_mul_ssse3;
+        kernels->symbol_add = gf256_symbol_add_ssse3;
+        break;
+#endif
+    default:
+        kernels->tier = CPU_TIER_SCALAR;
+        kernels->symbol_add_scaled = gf256_symbol_add_scaled;
+        kernels->symbol_mul = gf256_symbol_mul;
+        kernels->symbol_add = gf256_symbol_add;
+        break;
+    }
+}
+
 void assign_mul(uint8_t** array) {
     for (int i = 0; i < 256; i++) {
         for (int j = 0; j < 256; j++) {
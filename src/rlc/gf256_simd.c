@@ -0,0 +1,289 @@
+/**
+ * @file gf256_simd.c
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief rlc/gf256_simd.h implementation.
+ * @date 2024-03-14
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#include <string.h>
+
+#include <rlc/gf256.h>
+#include <rlc/gf256_simd.h>
+
+#ifdef CPU_X86
+#include <immintrin.h>
+
+/**
+ * @brief Function attributes that enable instructions of the corresponding tier.
+ */
+#define GF256_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define GF256_TARGET_AVX2 __attribute__((target("avx2")))
+#define GF256_TARGET_AVX512BW __attribute__((target("avx512f,avx512bw")))
+
+/**
+ * @brief Fill split-nibble tables: lo[v] = c * v, hi[v] = c * (v << 4).
+ */
+static inline void _gf256_fill_tables(const uint8_t* mul_row, uint8_t* lo, uint8_t* hi) {
+    for (uint8_t v = 0; v < 16; ++v) {
+        lo[v] = mul_row[v];
+        hi[v] = mul_row[v << 4];
+    }
+}
+
+/**
+ * @brief Process symbol tails that don't fit into SIMD registers.
+ */
+static inline void _gf256_add_tail(uint8_t* data_1, const uint8_t* data_2, uint32_t cnt) {
+    for (const uint8_t* end_1 = data_1 + cnt; data_1 != end_1; ++data_1, ++data_2)
+        *data_1 ^= *data_2;
+}
+
+static inline void _gf256_add_scaled_tail(uint8_t* data_1, const uint8_t* data_2, uint32_t cnt,
+                                          const uint8_t* mul_row) {
+    for (const uint8_t* end_1 = data_1 + cnt; data_1 != end_1; ++data_1, ++data_2)
+        *data_1 ^= mul_row[*data_2];
+}
+
+static inline void _gf256_mul_tail(uint8_t* data, uint32_t cnt, const uint8_t* mul_row) {
+    for (const uint8_t* end = data + cnt; data != end; ++data)
+        *data = mul_row[*data];
+}
+
+/*
+ * SSSE3 kernels.
+ */
+
+GF256_TARGET_SSSE3 void gf256_symbol_add_ssse3(void* symbol1, const void* symbol2, uint32_t symbol_size) {
+    uint8_t* data_1 = (uint8_t*)symbol1;
+    const uint8_t* data_2 = (const uint8_t*)symbol2;
+    uint32_t vec_size = symbol_size & ~(uint32_t)15;
+
+    for (const uint8_t* end_1 = data_1 + vec_size; data_1 != end_1; data_1 += 16, data_2 += 16) {
+        __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i*)data_1), _mm_loadu_si128((const __m128i*)data_2));
+        _mm_storeu_si128((__m128i*)data_1, x);
+    }
+
+    _gf256_add_tail(data_1, data_2, symbol_size - vec_size);
+}
+
+GF256_TARGET_SSSE3 void gf256_symbol_add_scaled_ssse3(void* symbol1, uint8_t coef, const void* symbol2,
+                                                      uint32_t symbol_size, uint8_t** mul) {
+    if (coef == 0)
+        return;
+
+    if (coef == 1) {
+        gf256_symbol_add_ssse3(symbol1, symbol2, symbol_size);
+        return;
+    }
+
+    uint8_t lo[16];
+    uint8_t hi[16];
+    _gf256_fill_tables(mul[coef], lo, hi);
+
+    const __m128i t_lo = _mm_loadu_si128((const __m128i*)lo);
+    const __m128i t_hi = _mm_loadu_si128((const __m128i*)hi);
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    uint8_t* data_1 = (uint8_t*)symbol1;
+    const uint8_t* data_2 = (const uint8_t*)symbol2;
+    uint32_t vec_size = symbol_size & ~(uint32_t)15;
+
+    for (const uint8_t* end_1 = data_1 + vec_size; data_1 != end_1; data_1 += 16, data_2 += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)data_2);
+        __m128i p_lo = _mm_shuffle_epi8(t_lo, _mm_and_si128(x, mask));
+        __m128i p_hi = _mm_shuffle_epi8(t_hi, _mm_and_si128(_mm_srli_epi64(x, 4), mask));
+        __m128i y = _mm_xor_si128(_mm_xor_si128(p_lo, p_hi), _mm_loadu_si128((const __m128i*)data_1));
+        _mm_storeu_si128((__m128i*)data_1, y);
+    }
+
+    _gf256_add_scaled_tail(data_1, data_2, symbol_size - vec_size, mul[coef]);
+}
+
+GF256_TARGET_SSSE3 void gf256_symbol_mul_ssse3(void* symbol1, uint8_t coef, uint32_t symbol_size, uint8_t** mul) {
+    if (coef == 0) {
+        memset(symbol1, 0, symbol_size);
+        return;
+    }
+
+    if (coef == 1)
+        return;
+
+    uint8_t lo[16];
+    uint8_t hi[16];
+    _gf256_fill_tables(mul[coef], lo, hi);
+
+    const __m128i t_lo = _mm_loadu_si128((const __m128i*)lo);
+    const __m128i t_hi = _mm_loadu_si128((const __m128i*)hi);
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    uint8_t* data = (uint8_t*)symbol1;
+    uint32_t vec_size = symbol_size & ~(uint32_t)15;
+
+    for (const uint8_t* end = data + vec_size; data != end; data += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)data);
+        __m128i p_lo = _mm_shuffle_epi8(t_lo, _mm_and_si128(x, mask));
+        __m128i p_hi = _mm_shuffle_epi8(t_hi, _mm_and_si128(_mm_srli_epi64(x, 4), mask));
+        _mm_storeu_si128((__m128i*)data, _mm_xor_si128(p_lo, p_hi));
+    }
+
+    _gf256_mul_tail(data, symbol_size - vec_size, mul[coef]);
+}
+
+/*
+ * AVX2 kernels.
+ */
+
+GF256_TARGET_AVX2 void gf256_symbol_add_avx2(void* symbol1, const void* symbol2, uint32_t symbol_size) {
+    uint8_t* data_1 = (uint8_t*)symbol1;
+    const uint8_t* data_2 = (const uint8_t*)symbol2;
+    uint32_t vec_size = symbol_size & ~(uint32_t)31;
+
+    for (const uint8_t* end_1 = data_1 + vec_size; data_1 != end_1; data_1 += 32, data_2 += 32) {
+        __m256i x =
+            _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)data_1), _mm256_loadu_si256((const __m256i*)data_2));
+        _mm256_storeu_si256((__m256i*)data_1, x);
+    }
+
+    _gf256_add_tail(data_1, data_2, symbol_size - vec_size);
+}
+
+GF256_TARGET_AVX2 void gf256_symbol_add_scaled_avx2(void* symbol1, uint8_t coef, const void* symbol2,
+                                                    uint32_t symbol_size, uint8_t** mul) {
+    if (coef == 0)
+        return;
+
+    if (coef == 1) {
+        gf256_symbol_add_avx2(symbol1, symbol2, symbol_size);
+        return;
+    }
+
+    uint8_t lo[16];
+    uint8_t hi[16];
+    _gf256_fill_tables(mul[coef], lo, hi);
+
+    const __m256i t_lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)lo));
+    const __m256i t_hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)hi));
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+    uint8_t* data_1 = (uint8_t*)symbol1;
+    const uint8_t* data_2 = (const uint8_t*)symbol2;
+    uint32_t vec_size = symbol_size & ~(uint32_t)31;
+
+    for (const uint8_t* end_1 = data_1 + vec_size; data_1 != end_1; data_1 += 32, data_2 += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)data_2);
+        __m256i p_lo = _mm256_shuffle_epi8(t_lo, _mm256_and_si256(x, mask));
+        __m256i p_hi = _mm256_shuffle_epi8(t_hi, _mm256_and_si256(_mm256_srli_epi64(x, 4), mask));
+        __m256i y = _mm256_xor_si256(_mm256_xor_si256(p_lo, p_hi), _mm256_loadu_si256((const __m256i*)data_1));
+        _mm256_storeu_si256((__m256i*)data_1, y);
+    }
+
+    _gf256_add_scaled_tail(data_1, data_2, symbol_size - vec_size, mul[coef]);
+}
+
+GF256_TARGET_AVX2 void gf256_symbol_mul_avx2(void* symbol1, uint8_t coef, uint32_t symbol_size, uint8_t** mul) {
+    if (coef == 0) {
+        memset(symbol1, 0, symbol_size);
+        return;
+    }
+
+    if (coef == 1)
+        return;
+
+    uint8_t lo[16];
+    uint8_t hi[16];
+    _gf256_fill_tables(mul[coef], lo, hi);
+
+    const __m256i t_lo = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)lo));
+    const __m256i t_hi = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)hi));
+    const __m256i mask = _mm256_set1_epi8(0x0f);
+    uint8_t* data = (uint8_t*)symbol1;
+    uint32_t vec_size = symbol_size & ~(uint32_t)31;
+
+    for (const uint8_t* end = data + vec_size; data != end; data += 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)data);
+        __m256i p_lo = _mm256_shuffle_epi8(t_lo, _mm256_and_si256(x, mask));
+        __m256i p_hi = _mm256_shuffle_epi8(t_hi, _mm256_and_si256(_mm256_srli_epi64(x, 4), mask));
+        _mm256_storeu_si256((__m256i*)data, _mm256_xor_si256(p_lo, p_hi));
+    }
+
+    _gf256_mul_tail(data, symbol_size - vec_size, mul[coef]);
+}
+
+/*
+ * AVX512BW kernels.
+ */
+
+GF256_TARGET_AVX512BW void gf256_symbol_add_avx512bw(void* symbol1, const void* symbol2, uint32_t symbol_size) {
+    uint8_t* data_1 = (uint8_t*)symbol1;
+    const uint8_t* data_2 = (const uint8_t*)symbol2;
+    uint32_t vec_size = symbol_size & ~(uint32_t)63;
+
+    for (const uint8_t* end_1 = data_1 + vec_size; data_1 != end_1; data_1 += 64, data_2 += 64) {
+        __m512i x = _mm512_xor_si512(_mm512_loadu_si512((const void*)data_1), _mm512_loadu_si512((const void*)data_2));
+        _mm512_storeu_si512((void*)data_1, x);
+    }
+
+    _gf256_add_tail(data_1, data_2, symbol_size - vec_size);
+}
+
+GF256_TARGET_AVX512BW void gf256_symbol_add_scaled_avx512bw(void* symbol1, uint8_t coef, const void* symbol2,
+                                                            uint32_t symbol_size, uint8_t** mul) {
+    if (coef == 0)
+        return;
+
+    if (coef == 1) {
+        gf256_symbol_add_avx512bw(symbol1, symbol2, symbol_size);
+        return;
+    }
+
+    uint8_t lo[16];
+    uint8_t hi[16];
+    _gf256_fill_tables(mul[coef], lo, hi);
+
+    const __m512i t_lo = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)lo));
+    const __m512i t_hi = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)hi));
+    const __m512i mask = _mm512_set1_epi8(0x0f);
+    uint8_t* data_1 = (uint8_t*)symbol1;
+    const uint8_t* data_2 = (const uint8_t*)symbol2;
+    uint32_t vec_size = symbol_size & ~(uint32_t)63;
+
+    for (const uint8_t* end_1 = data_1 + vec_size; data_1 != end_1; data_1 += 64, data_2 += 64) {
+        __m512i x = _mm512_loadu_si512((const void*)data_2);
+        __m512i p_lo = _mm512_shuffle_epi8(t_lo, _mm512_and_si512(x, mask));
+        __m512i p_hi = _mm512_shuffle_epi8(t_hi, _mm512_and_si512(_mm512_srli_epi64(x, 4), mask));
+        __m512i y = _mm512_xor_si512(_mm512_xor_si512(p_lo, p_hi), _mm512_loadu_si512((const void*)data_1));
+        _mm512_storeu_si512((void*)data_1, y);
+    }
+
+    _gf256_add_scaled_tail(data_1, data_2, symbol_size - vec_size, mul[coef]);
+}
+
+GF256_TARGET_AVX512BW void gf256_symbol_mul_avx512bw(void* symbol1, uint8_t coef, uint32_t symbol_size, uint8_t** mul) {
+    if (coef == 0) {
+        memset(symbol1, 0, symbol_size);
+        return;
+    }
+
+    if (coef == 1)
+        return;
+
+    uint8_t lo[16];
+    uint8_t hi[16];
+    _gf256_fill_tables(mul[coef], lo, hi);
+
+    const __m512i t_lo = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)lo));
+    const __m512i t_hi = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)hi));
+    const __m512i mask = _mm512_set1_epi8(0x0f);
+    uint8_t* data = (uint8_t*)symbol1;
+    uint32_t vec_size = symbol_size & ~(uint32_t)63;
+
+    for (const uint8_t* end = data + vec_size; data != end; data += 64) {
+        __m512i x = _mm512_loadu_si512((const void*)data);
+        __m512i p_lo = _mm512_shuffle_epi8(t_lo, _mm512_and_si512(x, mask));
+        __m512i p_hi = _mm512_shuffle_epi8(t_hi, _mm512_and_si512(_mm512_srli_epi64(x, 4), mask));
+        _mm512_storeu_si512((void*)data, _mm512_xor_si512(p_lo, p_hi));
+    }
+
+    _gf256_mul_tail(data, symbol_size - vec_size, mul[coef]);
+}
+
+#endif
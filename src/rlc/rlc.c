@@ -64,6 +64,8 @@ RLC_t* rlc_create() {
     rlc->inv_table = inv_table;
     rlc->mul_table = mul_table;
 
+    gf256_select_kernels(&rlc->kernels, cpu_select_tier());
+
     return rlc;
 }
 
@@ -107,8 +109,8 @@ static int get_one_coded_symbol(RLC_t* rlc, const symbol_seq_t* inf_symbols, sym
     memset((void*)rep_symbol->data, 0, symbol_size);
 
     for (int j = 0; j < inf_symbols->length; j++) {
-        gf256_symbol_add_scaled((void*)rep_symbol->data, coefs[j], (void*)inf_symbols->symbols[j]->data, symbol_size,
-                                mul);
+        rlc->kernels.symbol_add_scaled((void*)rep_symbol->data, coefs[j], (void*)inf_symbols->symbols[j]->data,
+                                       symbol_size, mul);
     }
 
     free(coefs);
@@ -162,14 +164,14 @@ static int receive_repair_symbol(RLC_t* rlc, system_t* system, const symbol_seq_
     for (uint16_t i = 0; i < k; ++i) {
         if (is_erased[i])
             continue;
-        gf256_symbol_add_scaled((void*)eq->constant_term->data, eq->coefs[i], (void*)inf_symbols->symbols[i]->data,
-                                inf_symbols->symbol_size, mul_table);
+        rlc->kernels.symbol_add_scaled((void*)eq->constant_term->data, eq->coefs[i],
+                                       (void*)inf_symbols->symbols[i]->data, inf_symbols->symbol_size, mul_table);
         eq->coefs[i] = 0;
     }
 
     equation_adjust_non_zero_bounds(eq);
     if (equation_has_one_id(eq)) {
-        equation_multiply(eq, inv_table[equation_get_coef(eq, eq->pivot)], mul_table);
+        equation_multiply(eq, inv_table[equation_get_coef(eq, eq->pivot)], mul_table, &rlc->kernels);
     }
     if (equation_is_zero(eq)) {
         free(eq->coefs);
@@ -190,7 +192,7 @@ static int receive_repair_symbol(RLC_t* rlc, system_t* system, const symbol_seq_
     equation_t* removed = NULL;
     int used_in_system = 0;
 
-    system_add_with_elimination(system, eq, inv_table, mul_table, &decoded, &removed, &used_in_system);
+    system_add_with_elimination(system, eq, inv_table, mul_table, &rlc->kernels, &decoded, &removed, &used_in_system);
     if (!used_in_system) {
         free(eq->coefs);
         free(eq);
@@ -26,7 +26,8 @@ equation_t* system_get_pivot_for_id(system_t* system, uint16_t id) {
     return NULL;
 }
 
-static int reduce_equation(system_t* system, equation_t* eq, uint8_t** mul_table, uint8_t* inv_table) {
+static int reduce_equation(system_t* system, equation_t* eq, uint8_t** mul_table, uint8_t* inv_table,
+                           const gf256_kernels_t* kernels) {
 
     equation_adjust_non_zero_bounds(eq);
     if (eq->pivot == ID_NONE)
@@ -43,12 +44,12 @@ static int reduce_equation(system_t* system, equation_t* eq, uint8_t** mul_table
 
                 equation_multiply(eq,
                                   mul_table[equation_get_coef(pivot_equation, pivot_equation->pivot)][inv_table[coef]],
-                                  mul_table);
+                                  mul_table, kernels);
 
                 // we reduce the equation and remove its pivot coefficient by
                 // adding the multiplied equation and the system's pivot
                 // equation
-                err = equation_add(eq, pivot_equation);
+                err = equation_add(eq, pivot_equation, kernels);
                 if (err) {
                     break;
                 }
@@ -103,7 +104,7 @@ static uint32_t system_add(system_t* system, equation_t* eq, equation_t** remove
 }
 
 static uint32_t system_add_as_pivot(system_t* system, equation_t* eq, uint8_t* inv_table, uint8_t** mul_table,
-                                    int* decoded, equation_t** removed) {
+                                    const gf256_kernels_t* kernels, int* decoded, equation_t** removed) {
     *decoded = 0;
     equation_adjust_non_zero_bounds(eq);
     if (eq->pivot == ID_NONE) {
@@ -130,17 +131,17 @@ static uint32_t system_add_as_pivot(system_t* system, equation_t* eq, uint8_t* i
                 //            mul_table);
                 uint8_t pivot_coef = equation_get_coef(eq, eq->pivot);
                 assert(mul_table[inv_table[pivot_coef]][coef] != 0);
-                equation_multiply(eq, mul_table[inv_table[pivot_coef]][coef], mul_table);
+                equation_multiply(eq, mul_table[inv_table[pivot_coef]][coef], mul_table, kernels);
 
                 bool has_one_id_before_add = equation_has_one_id(system->equations[i]);
                 // int err = equation_add(system->equations[i], eq);
-                equation_add(system->equations[i], eq);
+                equation_add(system->equations[i], eq, kernels);
                 bool is_decoded = !has_one_id_before_add && equation_has_one_id(system->equations[i]);
                 if (is_decoded) {
                     uint16_t si = equation_get_min_symbol_id(system->equations[i]);
                     if (equation_get_coef(system->equations[i], si) != 1) {
                         equation_multiply(system->equations[i], inv_table[equation_get_coef(system->equations[i], si)],
-                                          mul_table);
+                                          mul_table, kernels);
                     }
                     assert(equation_get_coef(system->equations[i], si) == 1);
                     *decoded = 1;
@@ -154,16 +155,17 @@ static uint32_t system_add_as_pivot(system_t* system, equation_t* eq, uint8_t* i
     return system_add(system, eq, removed);
 }
 
-int system_add_with_elimination(system_t* system, equation_t* eq, uint8_t* inv_table, uint8_t** mul_table, int* decoded,
-                                equation_t** removed, int* used_in_system) {
+int system_add_with_elimination(system_t* system, equation_t* eq, uint8_t* inv_table, uint8_t** mul_table,
+                                const gf256_kernels_t* kernels, int* decoded, equation_t** removed,
+                                int* used_in_system) {
     *removed = NULL;
     *decoded = 0;
     *used_in_system = 0;
 
-    int err = reduce_equation(system, eq, mul_table, inv_table);
+    int err = reduce_equation(system, eq, mul_table, inv_table, kernels);
 
     if (!err && !equation_is_zero(eq)) {
-        uint32_t idx = system_add_as_pivot(system, eq, inv_table, mul_table, decoded, removed);
+        uint32_t idx = system_add_as_pivot(system, eq, inv_table, mul_table, kernels, decoded, removed);
 
         if (idx == ENTRY_INDEX_NONE || idx >= system->max_equations) {
             return 0;
@@ -177,7 +179,7 @@ int system_add_with_elimination(system_t* system, equation_t* eq, uint8_t* inv_t
             *decoded = 1;
             uint16_t si = equation_get_min_symbol_id(stored_symbol);
             if (equation_get_coef(stored_symbol, si) != 1) {
-                equation_multiply(stored_symbol, inv_table[equation_get_coef(stored_symbol, si)], mul_table);
+                equation_multiply(stored_symbol, inv_table[equation_get_coef(stored_symbol, si)], mul_table, kernels);
             }
             assert(equation_get_coef(stored_symbol, si) == 1);
         }
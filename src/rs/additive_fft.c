@@ -0,0 +1,211 @@
+/**
+ * @file additive_fft.c
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief rs/additive_fft.h implementation.
+ * @date 2024-04-02
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include <rs/additive_fft.h>
+#include <rs/tables.h>
+
+/**
+ * @brief Compute value of subspace polynomial at a point that is a multiple of the next subspace size.
+ * @details \f$s_i(\omega_j) = \sum_{b > i} j_b s_i(v_b)\f$, because \f$s_i\f$ is linear and vanishes on
+ * \f$v_0, \dots, v_{i-1}\f$, and \f$j_b = 0\f$ for \f$b \leq i\f$.
+ *
+ * @param i subspace polynomial index.
+ * @param j point index.
+ * @return \f$s_i(\omega_j)\f$.
+ * @warning pre: j is divisible by 2^(i+1)
+ */
+static element_t _afft_get_skew(uint8_t i, uint32_t j) {
+    assert((j & ((2u << i) - 1)) == 0);
+
+    const element_t* subspace = tables_cantor_subspace + i * AFFT_BASIS_SIZE;
+    element_t skew = 0;
+
+    for (; j != 0; j &= j - 1)
+        skew ^= subspace[__builtin_ctz(j)];
+
+    return skew;
+}
+
+/**
+ * @brief Fast Walsh-Hadamard transform modulo N.
+ * @details Transform is an involution up to multiplication by n.
+ *
+ * @param data transformed values, all of them are less than N.
+ * @param n number of values, power of 2.
+ */
+static void _afft_fwht(uint16_t* data, uint32_t n) {
+    for (uint32_t half = 1; half < n; half <<= 1) {
+        for (uint32_t j = 0; j < n; j += half << 1) {
+            for (uint32_t t = j; t < j + half; ++t) {
+                uint32_t a = data[t];
+                uint32_t b = data[t + half];
+                uint32_t sum = a + b;
+                uint32_t diff = a + N - b;
+
+                data[t] = (uint16_t)(sum >= N ? sum - N : sum);
+                data[t + half] = (uint16_t)(diff >= N ? diff - N : diff);
+            }
+        }
+    }
+}
+
+element_t afft_get_point(uint32_t idx) {
+    assert(idx < AFFT_MAX_LENGTH);
+
+    element_t point = 0;
+
+    for (; idx != 0; idx &= idx - 1)
+        point ^= tables_cantor_subspace[__builtin_ctz(idx)];
+
+    return point;
+}
+
+void afft_transform(GF_t* gf, symbol_seq_t* f, uint32_t offset) {
+    assert(gf != NULL);
+    assert(f != NULL);
+    assert(f->length > 0 && (f->length & (f->length - 1)) == 0);
+    assert(offset % f->length == 0);
+    assert(offset + f->length <= AFFT_MAX_LENGTH);
+
+    size_t symbol_size = f->symbol_size;
+    uint32_t len = (uint32_t)f->length;
+    gf_coef_tables_t tables;
+
+    // f = f_0 + s_i * f_1 on [j; j + 2 * half), where s_i is constant on the first half of points and equal to
+    // (s_i + 1) on the second one, so halves are transformed polynomials (f_0 + s_i * f_1) and (f_0 + s_i * f_1 + f_1)
+    for (uint32_t half = len >> 1; half > 0; half >>= 1) {
+        uint8_t i = (uint8_t)__builtin_ctz(half);
+
+        for (uint32_t j = 0; j < len; j += half << 1) {
+            element_t skew = _afft_get_skew(i, offset + j);
+
+            if (skew != 0)
+                gf_prepare_coef(gf, &tables, skew);
+
+            for (uint32_t t = j; t < j + half; ++t) {
+                uint8_t* lo = f->symbols[t]->data;
+                uint8_t* hi = f->symbols[t + half]->data;
+
+                if (skew != 0)
+                    gf->madd((void*)lo, &tables, (const void*)hi, symbol_size);
+                gf->add((void*)hi, (const void*)lo, symbol_size);
+            }
+        }
+    }
+}
+
+void afft_inverse_transform(GF_t* gf, symbol_seq_t* f, uint32_t offset) {
+    assert(gf != NULL);
+    assert(f != NULL);
+    assert(f->length > 0 && (f->length & (f->length - 1)) == 0);
+    assert(offset % f->length == 0);
+    assert(offset + f->length <= AFFT_MAX_LENGTH);
+
+    size_t symbol_size = f->symbol_size;
+    uint32_t len = (uint32_t)f->length;
+    gf_coef_tables_t tables;
+
+    // butterflies of afft_transform(...) in reverse order
+    for (uint32_t half = 1; half < len; half <<= 1) {
+        uint8_t i = (uint8_t)__builtin_ctz(half);
+
+        for (uint32_t j = 0; j < len; j += half << 1) {
+            element_t skew = _afft_get_skew(i, offset + j);
+
+            if (skew != 0)
+                gf_prepare_coef(gf, &tables, skew);
+
+            for (uint32_t t = j; t < j + half; ++t) {
+                uint8_t* lo = f->symbols[t]->data;
+                uint8_t* hi = f->symbols[t + half]->data;
+
+                gf->add((void*)hi, (const void*)lo, symbol_size);
+                if (skew != 0)
+                    gf->madd((void*)lo, &tables, (const void*)hi, symbol_size);
+            }
+        }
+    }
+}
+
+void afft_add_derivative(GF_t* gf, symbol_seq_t* f) {
+    assert(gf != NULL);
+    assert(f != NULL);
+    assert(f->length > 0 && (f->length & (f->length - 1)) == 0);
+
+    size_t symbol_size = f->symbol_size;
+    uint32_t len = (uint32_t)f->length;
+
+    // f_{j - 2^b} += f_j for each set bit b of j; coefficients [i; i + width) are read before they are modified by
+    // iterations with larger i
+    for (uint32_t i = 1; i < len; ++i) {
+        uint32_t width = i & (~i + 1);
+
+        for (uint32_t t = i; t < i + width; ++t)
+            gf->add((void*)f->symbols[t - width]->data, (const void*)f->symbols[t]->data, symbol_size);
+    }
+}
+
+int afft_get_locator_logs(GF_t* gf, workspace_t* ws, const bool* is_erased, uint32_t n, uint16_t* res) {
+    assert(gf != NULL);
+    assert(is_erased != NULL);
+    assert(res != NULL);
+    assert(n > 0 && (n & (n - 1)) == 0);
+    assert(n <= AFFT_MAX_LENGTH);
+
+    const uint16_t* log_table = gf->log_table;
+    uint16_t* logs;
+    uint32_t n_inv = GF_FIELD_SIZE / n; // 2^16 = 1 (mod N)
+    int err;
+
+    if (!ws) {
+        ws = workspace_create();
+        if (!ws)
+            return 1;
+
+        err = afft_get_locator_logs(gf, ws, is_erased, n, res);
+        workspace_destroy(ws);
+
+        return err;
+    }
+
+    size_t mark = workspace_mark(ws);
+
+    logs = (uint16_t*)workspace_alloc(ws, n * sizeof(uint16_t));
+    if (!logs)
+        return 1;
+
+    logs[0] = 0;
+    for (uint32_t x = 1; x < n; ++x)
+        logs[x] = logs[x & (x - 1)] ^ tables_cantor_subspace[__builtin_ctz(x)];
+
+    for (uint32_t x = 1; x < n; ++x)
+        logs[x] = log_table[logs[x]];
+
+    for (uint32_t j = 0; j < n; ++j)
+        res[j] = is_erased[j] ? 1 : 0;
+
+    // res = (is_erased (*) logs) / n, where (*) - XOR convolution
+    _afft_fwht(res, n);
+    _afft_fwht(logs, n);
+
+    for (uint32_t j = 0; j < n; ++j)
+        res[j] = (uint16_t)(((uint32_t)res[j] * logs[j]) % N);
+
+    _afft_fwht(res, n);
+
+    for (uint32_t j = 0; j < n; ++j)
+        res[j] = (uint16_t)(((uint32_t)res[j] * n_inv) % N);
+
+    workspace_release(ws, mark);
+
+    return 0;
+}
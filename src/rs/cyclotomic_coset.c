@@ -8,12 +8,12 @@
  */
 
 #include <assert.h>
-#include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <rs/cyclotomic_coset.h>
 #include <rs/prelude.h>
+#include <rs/tables.h>
 #include <util/util.h>
 
 /**
@@ -49,58 +49,29 @@ static const uint16_t g_leaders_cnt[CC_COSET_SIZES_CNT] = {[0] = CC_LEADERS_1_CN
 static const uint16_t g_thresholds[CC_COSET_SIZES_CNT] = {
     [0] = CC_THRESHOLD_1, [1] = CC_THRESHOLD_2, [2] = CC_THRESHOLD_4, [3] = CC_THRESHOLD_8, [4] = CC_THRESHOLD_16};
 
+/**
+ * @brief Average number of nonzero normal basis coefficients of a nonzero element of subfield multiplied by 16:
+ * \f$16 \cdot m 2^{m-1} / (2^m - 1)\f$ (see CC_SELECTION_COST).
+ */
+static const uint16_t g_additions_x16[CC_COSET_SIZES_CNT] = {[0] = 16, [1] = 21, [2] = 34, [3] = 64, [4] = 128};
+
+/**
+ * @brief Number of products of the final stage of cyclotomic FFT for a whole coset (see CC_SELECTION_COST).
+ */
+static const uint16_t g_products_cnt[CC_COSET_SIZES_CNT] = {[0] = 1, [1] = 4, [2] = 9, [3] = 27, [4] = 81};
+
 CC_t* cc_create() {
     CC_t* cc;
 
     cc = (CC_t*)malloc(sizeof(CC_t));
     if (!cc)
         return NULL;
-    memset((void*)cc, 0, sizeof(CC_t));
 
-    cc->leaders[0] = cc->_leaders_memory;
+    cc->leaders[0] = tables_cc_leaders;
     for (uint8_t i = 1; i < CC_COSET_SIZES_CNT; ++i)
         cc->leaders[i] = cc->leaders[i - 1] + g_leaders_cnt[i - 1];
 
-    bool* processed = (bool*)calloc(N, sizeof(bool));
-    if (!processed) {
-        free(cc);
-        return NULL;
-    }
-
-    uint16_t** leaders = cc->leaders;
-    uint16_t idx[CC_COSET_SIZES_CNT] = {0}; // idx[i] - index in leaders[i]
-
-    for (uint16_t s = 0; s < N; ++s) {
-        if (processed[s])
-            continue;
-        processed[s] = true;
-
-        uint16_t cur_coset_elem = NEXT_COSET_ELEMENT(s);
-        uint8_t coset_size;
-        for (coset_size = 1; coset_size <= CC_MAX_COSET_SIZE; ++coset_size) {
-            if (cur_coset_elem == s)
-                break;
-            processed[cur_coset_elem] = true;
-            cur_coset_elem = NEXT_COSET_ELEMENT(cur_coset_elem);
-        }
-
-        uint8_t i = 0;
-        while (i < CC_COSET_SIZES_CNT && (1 << i) != coset_size)
-            ++i;
-
-        assert(i < CC_COSET_SIZES_CNT);
-        assert(idx[i] < g_leaders_cnt[i]);
-
-        leaders[i][idx[i]++] = s;
-    }
-
-    assert(idx[0] == CC_LEADERS_1_CNT);
-    assert(idx[1] == CC_LEADERS_2_CNT);
-    assert(idx[2] == CC_LEADERS_4_CNT);
-    assert(idx[3] == CC_LEADERS_8_CNT);
-    assert(idx[4] == CC_LEADERS_16_CNT);
-
-    free(processed);
+    cc->selection = CC_SELECTION_GREEDY;
 
     return cc;
 }
@@ -121,46 +92,46 @@ uint8_t cc_get_coset_size(uint16_t leader) {
     return m;
 }
 
+void cc_set_selection(CC_t* cc, cc_selection_t selection) {
+    assert(cc != NULL);
+
+    cc->selection = selection;
+}
+
 /**
- * @brief Compute a number of cyclotomic cosets the union of which has a given
- * size.
+ * @brief Compute upper limit on the number of cyclotomic cosets the union of which covers a given number of positions,
+ * so that each coset contains at least one of them.
+ * @details All cosets except for at most CC_SMALL_COSETS_CNT ones have size CC_MAX_COSET_SIZE.
  *
- * @param r union size.
- * @return number of cyclotomic cosets.
+ * @param n number of positions.
+ * @return upper limit on the number of cyclotomic cosets.
  */
-static uint16_t _cc_get_cosets_cnt(uint16_t r) {
-    uint16_t cosets_cnt = 0;
-
-    for (uint8_t i = CC_COSET_SIZES_CNT - 1; r != 0; --i) {
-        if (r > g_thresholds[i]) {
-            uint16_t cosets_cnt_inc = (r - g_thresholds[i] + (1 << i) - 1) >> i;
-            cosets_cnt += cosets_cnt_inc;
-            r -= cosets_cnt_inc << i;
-        }
-        if (i == 0)
-            break;
-    }
-
-    assert(r == 0);
-
-    return cosets_cnt;
+static uint16_t _cc_get_max_cosets_cnt(uint16_t n) {
+    return (uint16_t)MIN(n, CC_SMALL_COSETS_CNT + (n + CC_MAX_COSET_SIZE - 1) / CC_MAX_COSET_SIZE);
 }
 
 void cc_estimate_cosets_cnt(uint16_t k, uint16_t r, uint16_t* inf_max_cnt, uint16_t* rep_max_cnt) {
-    *inf_max_cnt = _cc_get_cosets_cnt(k); // upper limit
-    *rep_max_cnt = _cc_get_cosets_cnt(r); // accurate estimation
+    *inf_max_cnt = _cc_get_max_cosets_cnt(k);
+    *rep_max_cnt = _cc_get_max_cosets_cnt(r);
 }
 
-void cc_select_cosets(CC_t* cc, uint16_t k, uint16_t r, coset_t* inf_cosets, uint16_t inf_max_cnt,
-                      uint16_t* inf_cosets_cnt, coset_t* rep_cosets, uint16_t rep_max_cnt, uint16_t* rep_cosets_cnt) {
-    assert(cc != NULL);
-    assert(k + r <= N);
-    assert(inf_cosets != NULL);
-    assert(inf_cosets_cnt != NULL);
-    assert(rep_cosets != NULL);
-    assert(rep_cosets_cnt != NULL);
-
-    uint16_t* const* leaders = cc->leaders;
+/**
+ * @brief Select cosets by CC_SELECTION_GREEDY strategy (see cc_select_cosets(...)).
+ *
+ * @param cc cyclotomic cosets data.
+ * @param k number of information symbols.
+ * @param r number of repair symbols.
+ * @param inf_cosets where to place information symbol cosets.
+ * @param inf_max_cnt max number of elements that can be written to inf_cosets.
+ * @param inf_cosets_cnt where to place number of written information symbol cosets.
+ * @param rep_cosets where to place repair symbol cosets.
+ * @param rep_max_cnt max number of elements that can be written to rep_cosets.
+ * @param rep_cosets_cnt where to place number of written repair symbol cosets.
+ */
+static void _cc_select_cosets_greedy(CC_t* cc, uint16_t k, uint16_t r, coset_t* inf_cosets, uint16_t inf_max_cnt,
+                                     uint16_t* inf_cosets_cnt, coset_t* rep_cosets, uint16_t rep_max_cnt,
+                                     uint16_t* rep_cosets_cnt) {
+    const uint16_t* const* leaders = cc->leaders;
     uint16_t idx[CC_COSET_SIZES_CNT] = {0};            // idx[i] - index in leaders[i]
     uint16_t inf_thresholds[CC_COSET_SIZES_CNT] = {0}; // inf_threshold[i] - threshold for
                                                        // using cyclotomic cosets of size
@@ -206,6 +177,175 @@ void cc_select_cosets(CC_t* cc, uint16_t k, uint16_t r, coset_t* inf_cosets, uin
     *inf_cosets_cnt = inf_idx;
 }
 
+/**
+ * @brief Compute modeled cost of repair coset multiplied by 16 * (k + r) (see CC_SELECTION_COST).
+ *
+ * @param k number of information symbols.
+ * @param r number of repair symbols.
+ * @param i coset size index (coset size is 2^i).
+ * @return modeled cost.
+ */
+static uint64_t _cc_get_rep_coset_cost(uint16_t k, uint16_t r, uint8_t i) {
+    return ((uint64_t)k + r) * ((uint64_t)r * g_additions_x16[i] + 16 * CC_COST_MUL * g_products_cnt[i]);
+}
+
+/**
+ * @brief Compute modeled cost of information coset multiplied by 16 * (k + r) (see CC_SELECTION_COST).
+ *
+ * @param k number of information symbols.
+ * @param r number of repair symbols.
+ * @param i coset size index (coset size is 2^i).
+ * @return modeled cost.
+ */
+static uint64_t _cc_get_inf_coset_cost(uint16_t k, uint16_t r, uint8_t i) {
+    uint64_t touched = MIN(((uint64_t)r) << i, (uint64_t)k + r); // probability of erasure in coset * (k + r)
+
+    return touched * ((uint64_t)r * g_additions_x16[i] + (16 * CC_COST_MUL << i));
+}
+
+/**
+ * @brief Add cosets of a given size to the list of selected cosets.
+ *
+ * @param leaders leaders of cyclotomic cosets of the size.
+ * @param i coset size index (coset size is 2^i).
+ * @param cnt number of cosets.
+ * @param cosets list of cosets.
+ * @param idx where to place the next coset of the list, will be increased by cnt.
+ * @param max_cnt max number of elements in the list.
+ */
+static void _cc_push_cosets(const uint16_t* leaders, uint8_t i, uint16_t cnt, coset_t* cosets, uint16_t* idx,
+                            uint16_t max_cnt) {
+    assert(*idx + cnt <= max_cnt);
+    (void)max_cnt;
+
+    for (uint16_t c = 0; c < cnt; ++c)
+        INIT_COSET(cosets[(*idx)++], leaders[c], 1 << i);
+}
+
+/**
+ * @brief Select cosets by CC_SELECTION_COST strategy (see cc_select_cosets(...)).
+ * @details Counts of small cosets of repair and information symbols are enumerated, the counts of cosets of size 16
+ * follow from them. Repair symbols take the first leaders of each size, information symbols take the next ones. Ties
+ * are broken by the enumeration order, so the selection is deterministic.
+ *
+ * @param cc cyclotomic cosets data.
+ * @param k number of information symbols.
+ * @param r number of repair symbols.
+ * @param inf_cosets where to place information symbol cosets.
+ * @param inf_max_cnt max number of elements that can be written to inf_cosets.
+ * @param inf_cosets_cnt where to place number of written information symbol cosets.
+ * @param rep_cosets where to place repair symbol cosets.
+ * @param rep_max_cnt max number of elements that can be written to rep_cosets.
+ * @param rep_cosets_cnt where to place number of written repair symbol cosets.
+ */
+static void _cc_select_cosets_by_cost(CC_t* cc, uint16_t k, uint16_t r, coset_t* inf_cosets, uint16_t inf_max_cnt,
+                                      uint16_t* inf_cosets_cnt, coset_t* rep_cosets, uint16_t rep_max_cnt,
+                                      uint16_t* rep_cosets_cnt) {
+    const uint8_t big = CC_COSET_SIZES_CNT - 1; // index of size CC_MAX_COSET_SIZE
+    uint64_t rep_costs[CC_COSET_SIZES_CNT];
+    uint64_t inf_costs[CC_COSET_SIZES_CNT];
+    uint16_t rep_cnt[CC_COSET_SIZES_CNT] = {0}; // rep_cnt[i] - number of repair cosets of size 2^i
+    uint16_t inf_cnt[CC_COSET_SIZES_CNT] = {0};
+    uint16_t best_rep_cnt[CC_COSET_SIZES_CNT] = {0};
+    uint16_t best_inf_cnt[CC_COSET_SIZES_CNT] = {0};
+    uint64_t best_cost = UINT64_MAX;
+    uint16_t rep_idx = 0;
+    uint16_t inf_idx = 0;
+
+    for (uint8_t i = 0; i < CC_COSET_SIZES_CNT; ++i) {
+        rep_costs[i] = _cc_get_rep_coset_cost(k, r, i);
+        inf_costs[i] = _cc_get_inf_coset_cost(k, r, i);
+    }
+
+    // mixed radix enumeration of rep_cnt[0..big), digit i runs over [0; g_leaders_cnt[i]]
+    while (true) {
+        uint32_t rep_small = 0;
+        uint64_t rep_cost = 0;
+
+        for (uint8_t i = 0; i < big; ++i) {
+            rep_small += (uint32_t)rep_cnt[i] << i;
+            rep_cost += rep_cnt[i] * rep_costs[i];
+        }
+
+        if (rep_small <= r && (r - rep_small) % CC_MAX_COSET_SIZE == 0) {
+            rep_cnt[big] = (uint16_t)((r - rep_small) / CC_MAX_COSET_SIZE);
+            rep_cost += rep_cnt[big] * rep_costs[big];
+
+            memset((void*)inf_cnt, 0, sizeof(inf_cnt));
+
+            // mixed radix enumeration of inf_cnt[0..big), digit i runs over [0; g_leaders_cnt[i] - rep_cnt[i]]
+            while (true) {
+                uint32_t inf_small = 0;
+                uint64_t inf_cost = 0;
+                uint8_t min_size = CC_MAX_COSET_SIZE; // size of the last information coset
+
+                for (uint8_t i = 0; i < big; ++i) {
+                    inf_small += (uint32_t)inf_cnt[i] << i;
+                    inf_cost += inf_cnt[i] * inf_costs[i];
+                    if (inf_cnt[i] != 0 && min_size == CC_MAX_COSET_SIZE)
+                        min_size = 1 << i;
+                }
+
+                inf_cnt[big] =
+                    (uint16_t)(inf_small < k ? (k - inf_small + CC_MAX_COSET_SIZE - 1) / CC_MAX_COSET_SIZE : 0);
+                inf_cost += inf_cnt[big] * inf_costs[big];
+
+                uint32_t inf_total = inf_small + ((uint32_t)inf_cnt[big] << big);
+
+                // only the last coset may be partially used
+                if (inf_total >= k && inf_total - k < min_size &&
+                    (uint32_t)rep_cnt[big] + inf_cnt[big] <= g_leaders_cnt[big] && rep_cost + inf_cost < best_cost) {
+                    best_cost = rep_cost + inf_cost;
+                    memcpy((void*)best_rep_cnt, (void*)rep_cnt, sizeof(rep_cnt));
+                    memcpy((void*)best_inf_cnt, (void*)inf_cnt, sizeof(inf_cnt));
+                }
+
+                uint8_t i = 0;
+                while (i < big && inf_cnt[i] == g_leaders_cnt[i] - rep_cnt[i])
+                    inf_cnt[i++] = 0;
+                if (i == big)
+                    break;
+                ++inf_cnt[i];
+            }
+        }
+
+        uint8_t i = 0;
+        while (i < big && rep_cnt[i] == g_leaders_cnt[i])
+            rep_cnt[i++] = 0;
+        if (i == big)
+            break;
+        ++rep_cnt[i];
+    }
+
+    assert(best_cost != UINT64_MAX);
+
+    // the largest cosets first, so that the partially used information coset is the last one
+    for (uint8_t i = CC_COSET_SIZES_CNT; i-- > 0;) {
+        _cc_push_cosets(cc->leaders[i], i, best_rep_cnt[i], rep_cosets, &rep_idx, rep_max_cnt);
+        _cc_push_cosets(cc->leaders[i] + best_rep_cnt[i], i, best_inf_cnt[i], inf_cosets, &inf_idx, inf_max_cnt);
+    }
+
+    *rep_cosets_cnt = rep_idx;
+    *inf_cosets_cnt = inf_idx;
+}
+
+void cc_select_cosets(CC_t* cc, uint16_t k, uint16_t r, coset_t* inf_cosets, uint16_t inf_max_cnt,
+                      uint16_t* inf_cosets_cnt, coset_t* rep_cosets, uint16_t rep_max_cnt, uint16_t* rep_cosets_cnt) {
+    assert(cc != NULL);
+    assert(k + r <= N);
+    assert(inf_cosets != NULL);
+    assert(inf_cosets_cnt != NULL);
+    assert(rep_cosets != NULL);
+    assert(rep_cosets_cnt != NULL);
+
+    if (cc->selection == CC_SELECTION_COST)
+        _cc_select_cosets_by_cost(cc, k, r, inf_cosets, inf_max_cnt, inf_cosets_cnt, rep_cosets, rep_max_cnt,
+                                  rep_cosets_cnt);
+    else
+        _cc_select_cosets_greedy(cc, k, r, inf_cosets, inf_max_cnt, inf_cosets_cnt, rep_cosets, rep_max_cnt,
+                                 rep_cosets_cnt);
+}
+
 void cc_cosets_to_positions(const coset_t* cosets, uint16_t cosets_cnt, uint16_t* positions, uint16_t positions_cnt) {
     assert(cosets != NULL);
     assert(positions != NULL);
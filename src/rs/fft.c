@@ -8,11 +8,56 @@
  */
 
 #include <assert.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include <rs/fft.h>
+#include <util/util.h>
+
+/**
+ * @brief Number of subsets of combined inputs that contain at least 2 inputs.
+ */
+#define FFT_CYCL_COMBINATIONS_CNT ((1 << FFT_CYCL_COMBINED_INPUTS_CNT) - 1 - FFT_CYCL_COMBINED_INPUTS_CNT)
+
+/**
+ * @brief Number of symbols used by cyclotomic FFT for expansion of a cosets group: accumulators and subset XORs.
+ */
+#define FFT_CYCL_EXPANSION_SYMBOLS_CNT (FFT_CYCL_COSETS_GROUP_SIZE * CC_MAX_COSET_SIZE + FFT_CYCL_COMBINATIONS_CNT)
+
+/**
+ * @brief Number of symbols used by a thread of cyclotomic FFT: expansion symbols and destinations of discarded
+ * components of a coset.
+ */
+#define FFT_CYCL_THREAD_SYMBOLS_CNT (FFT_CYCL_EXPANSION_SYMBOLS_CNT + CC_MAX_COSET_SIZE)
+
+/**
+ * @brief Value of _fft_cycl_task_t::dst_idx for discarded components.
+ */
+#define FFT_CYCL_DISCARDED UINT16_MAX
+
+/**
+ * @brief Prime modulus of number theoretic transform: \f$3 \cdot 2^{30} + 1\f$.
+ * @details Sums of at most N / 2 logarithms are less than the modulus, so convolutions of logarithms are exact.
+ */
+#define FFT_NTT_PRIME 3221225473u
+
+/**
+ * @brief Primitive root modulo FFT_NTT_PRIME.
+ */
+#define FFT_NTT_PRIMITIVE_ROOT 5u
+
+/**
+ * @brief Binary logarithm of number theoretic transform length: linear convolution of 2 sequences of length N fits
+ * into \f$2^{17}\f$ elements.
+ */
+#define FFT_NTT_LOG_LENGTH 17
+
+/**
+ * @brief Number theoretic transform length.
+ */
+#define FFT_NTT_LENGTH (1u << FFT_NTT_LOG_LENGTH)
 
 // cppcheck-suppress unusedFunction
 void fft_transform(GF_t* gf, const symbol_seq_t* f, const uint16_t* positions, symbol_seq_t* res) {
@@ -23,7 +68,7 @@ void fft_transform(GF_t* gf, const symbol_seq_t* f, const uint16_t* positions, s
     assert(f->symbol_size == res->symbol_size);
 
     size_t symbol_size = f->symbol_size;
-    element_t* pow_table = gf->pow_table;
+    const element_t* pow_table = gf->pow_table;
     element_t coef;
 
     for (uint16_t j = 0; j < res->length; ++j) {
@@ -36,67 +81,527 @@ void fft_transform(GF_t* gf, const symbol_seq_t* f, const uint16_t* positions, s
     }
 }
 
+/**
+ * @brief Add tiles of FFT_CYCL_COMBINED_INPUTS_CNT input symbols to accumulators of a group of cyclotomic cosets.
+ * @details Four-Russians method: XORs of all subsets of inputs are computed once, then every accumulator is updated by
+ * a single addition of the subset XOR selected by corresponding bits of normal basis representations.
+ *
+ * @param gf Galois field data.
+ * @param f sequence coefficients.
+ * @param first index of the first combined input.
+ * @param reprs reprs[i * FFT_CYCL_COSETS_GROUP_SIZE + g] - normal basis representation of i-th term for g-th coset.
+ * @param cosets_cnt number of cyclotomic cosets in the group.
+ * @param u accumulators and subset XORs (see _fft_expand_cosets(...)).
+ * @param offset tile offset in bytes.
+ * @param tile_size tile size in bytes.
+ */
+static void _fft_expand_combined(GF_t* gf, const symbol_seq_t* f, uint16_t first, const uint16_t* reprs,
+                                 uint8_t cosets_cnt, symbol_seq_t* u, size_t offset, size_t tile_size) {
+    const void* subsets[1 << FFT_CYCL_COMBINED_INPUTS_CNT]; // subsets[c] - XOR of inputs from bit mask c
+    symbol_t* const* combinations = u->symbols + FFT_CYCL_COSETS_GROUP_SIZE * CC_MAX_COSET_SIZE;
+    uint8_t combinations_cnt = 0;
+
+    subsets[0] = NULL;
+    for (uint8_t c = 1; c < (1 << FFT_CYCL_COMBINED_INPUTS_CNT); ++c) {
+        uint8_t j = __builtin_ctz(c);
+        const void* input = (const void*)(f->symbols[first + j]->data + offset);
+
+        if (c == (1 << j)) {
+            subsets[c] = input;
+            continue;
+        }
+
+        void* combination = (void*)combinations[combinations_cnt++]->data;
+        memcpy(combination, subsets[c & (c - 1)], tile_size);
+        gf_add_symbols(gf, combination, input, tile_size);
+        subsets[c] = (const void*)combination;
+    }
+
+    assert(combinations_cnt == FFT_CYCL_COMBINATIONS_CNT);
+
+    const uint16_t* first_reprs = reprs + (size_t)first * FFT_CYCL_COSETS_GROUP_SIZE;
+
+    for (uint8_t g = 0; g < cosets_cnt; ++g) {
+        symbol_t* const* acc = u->symbols + g * CC_MAX_COSET_SIZE;
+        uint16_t input_reprs[FFT_CYCL_COMBINED_INPUTS_CNT];
+        uint16_t used = 0; // normal basis elements used by any of inputs
+
+        for (uint8_t j = 0; j < FFT_CYCL_COMBINED_INPUTS_CNT; ++j) {
+            input_reprs[j] = first_reprs[j * FFT_CYCL_COSETS_GROUP_SIZE + g];
+            used |= input_reprs[j];
+        }
+
+        for (; used != 0; used &= used - 1) {
+            uint8_t t = __builtin_ctz(used);
+            uint8_t c = 0;
+
+            for (uint8_t j = 0; j < FFT_CYCL_COMBINED_INPUTS_CNT; ++j)
+                c |= ((input_reprs[j] >> t) & 1) << j;
+
+            gf_add_symbols(gf, (void*)(acc[t]->data + offset), subsets[c], tile_size);
+        }
+    }
+}
+
+/**
+ * @brief Compute sums of input symbols for a group of cyclotomic cosets.
+ * @details \f$u_{g,t} = \sum_{i : t \in repr_{g,i}} f_i\f$ for all cosets g of the group and all their normal basis
+ * elements t. Symbols are processed by tiles of FFT_CYCL_TILE_SIZE bytes: each tile of an input symbol is loaded once
+ * and added to the accumulators of all cosets of the group. For groups with at least
+ * FFT_CYCL_COMBINE_MIN_ACCUMULATORS accumulators inputs are combined by _fft_expand_combined(...).
+ *
+ * @param gf Galois field data.
+ * @param f sequence coefficients.
+ * @param reprs reprs[i * FFT_CYCL_COSETS_GROUP_SIZE + g] - normal basis representation of i-th term for g-th coset.
+ * @param sizes sizes of cyclotomic cosets.
+ * @param cosets_cnt number of cyclotomic cosets in the group.
+ * @param u FFT_CYCL_EXPANSION_SYMBOLS_CNT symbols: u_{g,t} is placed to (g * CC_MAX_COSET_SIZE + t)-th symbol, subset
+ * XORs of combined inputs are placed to the last FFT_CYCL_COMBINATIONS_CNT symbols.
+ */
+static void _fft_expand_cosets(GF_t* gf, const symbol_seq_t* f, const uint16_t* reprs, const uint8_t* sizes,
+                               uint8_t cosets_cnt, symbol_seq_t* u) {
+    size_t symbol_size = f->symbol_size;
+    uint16_t acc_cnt = 0;
+    uint16_t combined_cnt = 0; // number of inputs processed by _fft_expand_combined(...)
+
+    for (uint8_t g = 0; g < cosets_cnt; ++g) {
+        for (uint8_t t = 0; t < sizes[g]; ++t)
+            memset((void*)u->symbols[g * CC_MAX_COSET_SIZE + t]->data, 0, symbol_size);
+        acc_cnt += sizes[g];
+    }
+
+    if (acc_cnt >= FFT_CYCL_COMBINE_MIN_ACCUMULATORS)
+        combined_cnt = f->length - f->length % FFT_CYCL_COMBINED_INPUTS_CNT;
+
+    for (size_t offset = 0; offset < symbol_size; offset += FFT_CYCL_TILE_SIZE) {
+        size_t tile_size = MIN(FFT_CYCL_TILE_SIZE, symbol_size - offset);
+
+        for (uint16_t i = 0; i < combined_cnt; i += FFT_CYCL_COMBINED_INPUTS_CNT)
+            _fft_expand_combined(gf, f, i, reprs, cosets_cnt, u, offset, tile_size);
+
+        for (uint16_t i = combined_cnt; i < f->length; ++i) {
+            const void* tile = (const void*)(f->symbols[i]->data + offset);
+            const uint16_t* tile_reprs = reprs + (size_t)i * FFT_CYCL_COSETS_GROUP_SIZE;
+
+            for (uint8_t g = 0; g < cosets_cnt; ++g) {
+                symbol_t* const* acc = u->symbols + g * CC_MAX_COSET_SIZE;
+
+                for (uint16_t repr = tile_reprs[g]; repr != 0; repr &= repr - 1)
+                    gf_add_symbols(gf, (void*)(acc[__builtin_ctz(repr)]->data + offset), tile, tile_size);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Compute elements of a cyclotomic coset of size 1 or 2 from sums of input symbols.
+ * @details The normal basis of GF(2) is {1}, so the only element is \f$u_0\f$. Elements of the normal basis
+ * \f$\{\beta_0, \beta_1\}\f$ of GF(4) sum to 1, so \f$u_0 \beta_0 + u_1 \beta_1 = \beta_1 (u_0 + u_1) + u_0\f$
+ * and \f$u_0 \beta_1 + u_1 \beta_0 = \beta_0 (u_0 + u_1) + u_0\f$: both elements take a single multiplication,
+ * because \f$\beta_1 = \beta_0 + 1\f$. Scale factors are folded into the normal basis constants instead, as this
+ * takes two multiplications per element without an extra pass over the destination.
+ *
+ * @param gf Galois field data.
+ * @param dst destinations of coset elements, NULL for discarded ones.
+ * @param m coset size.
+ * @param scales scale factors of destinations.
+ * @param scaled whether any scale factor differs from 1.
+ * @param u sums of input symbols, the second one is overwritten if not scaled.
+ * @param symbol_size size of symbols.
+ * @warning pre: m <= 2
+ */
+static void _fft_cycl_output_small(GF_t* gf, void* const* dst, uint8_t m, const element_t* scales, bool scaled,
+                                   symbol_t* const* u, size_t symbol_size) {
+    assert(m <= 2);
+
+    void* u0 = (void*)u[0]->data;
+    void* u1 = m == 2 ? (void*)u[1]->data : NULL;
+
+    if (scaled) {
+        const void* src[2] = {(const void*)u0, (const void*)u1};
+
+        for (uint8_t j = 0; j < m; ++j) {
+            if (!dst[j])
+                continue;
+
+            element_t coefs[2];
+
+            for (uint8_t i = 0; i < m; ++i)
+                coefs[i] = gf_mul_ee(gf, scales[j], gf_get_normal_basis_element(gf, m, (uint8_t)((j + i) % m)));
+
+            memset(dst[j], 0, symbol_size);
+            gf_madd_multi(gf, dst[j], coefs, src, m, symbol_size);
+        }
+        return;
+    }
+
+    if (m == 1) {
+        if (dst[0])
+            memcpy(dst[0], u0, symbol_size);
+        return;
+    }
+
+    uint8_t first = dst[1] ? 1 : 0;
+    element_t beta = gf_get_normal_basis_element(gf, m, (uint8_t)(1 - first));
+
+    if (!dst[first])
+        return;
+
+    gf_add_symbols(gf, u1, (const void*)u0, symbol_size);
+
+    memcpy(dst[first], u0, symbol_size);
+    gf_madd(gf, dst[first], beta, (const void*)u1, symbol_size);
+
+    if (first == 1 && dst[0]) {
+        memcpy(dst[0], dst[1], symbol_size);
+        gf_add_symbols(gf, dst[0], (const void*)u1, symbol_size);
+    }
+}
+
+/**
+ * @brief Memory used by a thread of cyclotomic FFT.
+ */
+typedef struct {
+    /**
+     * @brief reprs[i * FFT_CYCL_COSETS_GROUP_SIZE + g] - normal basis representation of i-th input for g-th coset of
+     * the group.
+     */
+    uint16_t* reprs;
+
+    /**
+     * @brief Multiplication tables of scale factors of a coset.
+     */
+    gf_coef_tables_t* scale_tables;
+
+    /**
+     * @brief Expansion symbols followed by destinations of discarded components of a coset.
+     */
+    symbol_seq_t* u;
+} _fft_cycl_scratch_t;
+
+/**
+ * @brief Cyclotomic FFT task: groups of cyclotomic cosets are transformed independently, possibly by several threads.
+ */
+typedef struct {
+    /**
+     * @brief Galois field data.
+     */
+    GF_t* gf;
+
+    /**
+     * @brief Sequence coefficients.
+     */
+    const symbol_seq_t* f;
+
+    /**
+     * @brief Sequence coefficients indices for full transform, NULL for partial transform.
+     */
+    const uint16_t* positions;
+
+    /**
+     * @brief Cyclotomic cosets of components to be computed (negative components for partial transform).
+     */
+    const coset_t* cosets;
+
+    /**
+     * @brief Indices in res (or in dst_idx if it is set) of the first elements of cosets for partial transform, NULL
+     * for full transform.
+     */
+    const uint16_t* first_idx;
+
+    /**
+     * @brief Indices in res of elements of cosets or FFT_CYCL_DISCARDED, NULL if elements of cosets are placed to res
+     * consecutively.
+     */
+    const uint16_t* dst_idx;
+
+    /**
+     * @brief Scale factors of res symbols for partial transform, NULL if the result is not scaled.
+     */
+    const element_t* scales;
+
+    /**
+     * @brief Number of cyclotomic cosets.
+     */
+    uint16_t cosets_cnt;
+
+    /**
+     * @brief Number of cyclotomic cosets taken by a thread at once (at most FFT_CYCL_COSETS_GROUP_SIZE).
+     */
+    uint8_t group_size;
+
+    /**
+     * @brief Where to place the result.
+     */
+    symbol_seq_t* res;
+
+    /**
+     * @brief Memory of threads, one element per thread.
+     */
+    _fft_cycl_scratch_t* scratch;
+
+    /**
+     * @brief Index of the first coset of the next group.
+     */
+    atomic_uint next;
+
+    /**
+     * @brief Index of memory of the next thread in scratch.
+     */
+    atomic_uint next_scratch;
+} _fft_cycl_task_t;
+
+/**
+ * @brief Transform groups of cyclotomic cosets of the task until all of them are taken.
+ * @details Each thread has its own accumulators, and cosets write disjoint sets of result symbols.
+ *
+ * @param arg task (_fft_cycl_task_t).
+ */
+static void _fft_cycl_worker(void* arg) {
+    _fft_cycl_task_t* task = (_fft_cycl_task_t*)arg;
+    GF_t* gf = task->gf;
+    const symbol_seq_t* f = task->f;
+    const uint16_t* positions = task->positions;
+    symbol_seq_t* res = task->res;
+    size_t symbol_size = f->symbol_size;
+    _fft_cycl_scratch_t* scratch = task->scratch + atomic_fetch_add(&task->next_scratch, 1);
+    uint16_t* reprs = scratch->reprs;
+    gf_coef_tables_t* scale_tables = scratch->scale_tables;
+    symbol_seq_t* u = scratch->u;
+
+    const void* u_data[FFT_CYCL_COSETS_GROUP_SIZE * CC_MAX_COSET_SIZE];
+    uint8_t sizes[FFT_CYCL_COSETS_GROUP_SIZE];
+
+    for (uint16_t t = 0; t < FFT_CYCL_COSETS_GROUP_SIZE * CC_MAX_COSET_SIZE; ++t)
+        u_data[t] = (const void*)u->symbols[t]->data;
+
+    while (true) {
+        unsigned first = atomic_fetch_add(&task->next, task->group_size);
+        if (first >= task->cosets_cnt)
+            break;
+
+        const coset_t* cosets = task->cosets + first;
+        uint8_t group_cnt = (uint8_t)MIN(task->group_size, task->cosets_cnt - first);
+
+        for (uint8_t g = 0; g < group_cnt; ++g) {
+            uint8_t m = cosets[g].size;
+            uint32_t order = (1u << m) - 1; // subfield multiplicative group order
+
+            if (positions) {
+                uint32_t s_reduced = cosets[g].leader / GF_SUBFIELD_GENERATOR_POWER(m); // alpha^s = gamma^s_reduced
+
+                for (uint16_t i = 0; i < f->length; ++i)
+                    reprs[(size_t)i * FFT_CYCL_COSETS_GROUP_SIZE + g] =
+                        gf_get_normal_repr_reduced(gf, m, (uint16_t)((s_reduced * positions[i]) % order));
+            } else {
+                uint16_t s = N - cosets[g].leader;
+                uint32_t s_reduced = (s / GF_SUBFIELD_GENERATOR_POWER(m)) % order; // alpha^s = gamma^s_reduced
+                uint32_t d = 0;                                                    // alpha^(s * i) = gamma^d
+
+                for (uint16_t i = 0; i < f->length; ++i) {
+                    reprs[(size_t)i * FFT_CYCL_COSETS_GROUP_SIZE + g] =
+                        gf_get_normal_repr_reduced(gf, m, (uint16_t)d);
+
+                    d += s_reduced;
+                    if (d >= order)
+                        d -= order;
+                }
+            }
+
+            sizes[g] = m;
+        }
+
+        _fft_expand_cosets(gf, f, reprs, sizes, group_cnt, u);
+
+        for (uint8_t g = 0; g < group_cnt; ++g) {
+            uint8_t m = sizes[g];
+            void* dst[CC_MAX_COSET_SIZE];
+            element_t scales[CC_MAX_COSET_SIZE];
+            uint8_t dst_cnt = 0;
+            bool scaled = false;
+
+            if (positions) {
+                uint16_t idx = cosets[g].leader;
+
+                for (uint8_t j = 0; j < m; ++j) {
+                    dst[j] = idx < res->length ? (void*)res->symbols[idx]->data : NULL;
+                    scales[j] = 1;
+                    dst_cnt += idx < res->length;
+                    idx = NEXT_COSET_ELEMENT(idx);
+                }
+
+                assert(idx == cosets[g].leader);
+            } else if (task->dst_idx) {
+                const uint16_t* dst_idx = task->dst_idx + task->first_idx[first + g];
+
+                for (uint8_t j = 0; j < m; ++j) {
+                    assert(dst_idx[j] == FFT_CYCL_DISCARDED || dst_idx[j] < res->length);
+
+                    dst[j] = dst_idx[j] != FFT_CYCL_DISCARDED ? (void*)res->symbols[dst_idx[j]]->data : NULL;
+                    scales[j] = (dst_idx[j] != FFT_CYCL_DISCARDED && task->scales) ? task->scales[dst_idx[j]] : 1;
+                    dst_cnt += dst_idx[j] != FFT_CYCL_DISCARDED;
+                    scaled |= scales[j] != 1;
+                }
+            } else {
+                uint16_t idx = task->first_idx[first + g];
+
+                assert(idx + m <= res->length);
+
+                for (uint8_t j = 0; j < m; ++j, ++idx) {
+                    dst[j] = (void*)res->symbols[idx]->data;
+                    scales[j] = task->scales ? task->scales[idx] : 1;
+                    scaled |= scales[j] != 1;
+                }
+                dst_cnt = m;
+            }
+
+            if (m <= 2) {
+                _fft_cycl_output_small(gf, dst, m, scales, scaled, u->symbols + g * CC_MAX_COSET_SIZE, symbol_size);
+                continue;
+            }
+
+            // convolution computes all elements of a coset, direct computation takes m multiplications per element
+            if (m >= FFT_CYCL_CONVOLUTION_MIN_COSET_SIZE &&
+                (uint16_t)dst_cnt * m >= gf->normal_bases_convolutions[__builtin_ctz(m)].products_cnt) {
+                for (uint8_t j = 0; j < m; ++j) {
+                    if (!dst[j])
+                        dst[j] = (void*)u->symbols[FFT_CYCL_EXPANSION_SYMBOLS_CNT + j]->data;
+                    if (scaled)
+                        gf_prepare_coef(gf, scale_tables + j, scales[j]);
+                }
+
+                gf_normal_basis_convolution(gf, dst, m, scaled ? scale_tables : NULL, u_data + g * CC_MAX_COSET_SIZE,
+                                            symbol_size);
+                continue;
+            }
+
+            for (uint8_t j = 0; j < m; ++j) {
+                if (!dst[j])
+                    continue;
+
+                memset(dst[j], 0, symbol_size);
+                gf_madd_normal_basis(gf, dst[j], m, j, u_data + g * CC_MAX_COSET_SIZE, symbol_size);
+
+                // preparation of tables of scaled constants costs more than multiplication of the destination while it
+                // is still in L1 cache
+                if (scaled)
+                    gf_mul(gf, dst[j], scales[j], symbol_size);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Run cyclotomic FFT task on all threads of thread pool.
+ * @details Cosets are divided into groups so that each thread gets at least one group. Memory of all threads is taken
+ * from workspace before they are started.
+ *
+ * @param pool thread pool or NULL.
+ * @param ws workspace.
+ * @param task task with all fields set except for group_size, scratch, next and next_scratch.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+static int _fft_cycl_run(pool_t* pool, workspace_t* ws, _fft_cycl_task_t* task) {
+    uint16_t threads_cnt = pool_get_threads_cnt(pool);
+    uint32_t group_size = ((uint32_t)task->cosets_cnt + threads_cnt - 1) / threads_cnt;
+    size_t symbol_size = task->f->symbol_size;
+
+    task->scratch = (_fft_cycl_scratch_t*)workspace_alloc(ws, threads_cnt * sizeof(_fft_cycl_scratch_t));
+    if (!task->scratch)
+        return 1;
+
+    for (uint16_t i = 0; i < threads_cnt; ++i) {
+        _fft_cycl_scratch_t* scratch = task->scratch + i;
+
+        scratch->reprs =
+            (uint16_t*)workspace_alloc(ws, (size_t)task->f->length * FFT_CYCL_COSETS_GROUP_SIZE * sizeof(uint16_t));
+        scratch->scale_tables = (gf_coef_tables_t*)workspace_alloc(ws, CC_MAX_COSET_SIZE * sizeof(gf_coef_tables_t));
+        scratch->u = workspace_alloc_seq(ws, FFT_CYCL_THREAD_SYMBOLS_CNT, symbol_size);
+        if (!scratch->reprs || !scratch->scale_tables || !scratch->u)
+            return 1;
+    }
+
+    task->group_size = (uint8_t)MIN(FFT_CYCL_COSETS_GROUP_SIZE, MAX(group_size, 1));
+    atomic_init(&task->next, 0);
+    atomic_init(&task->next_scratch, 0);
+
+    pool_run(pool, _fft_cycl_worker, (void*)task);
+
+    return 0;
+}
+
 int fft_transform_cycl(GF_t* gf, const symbol_seq_t* f, const uint16_t* positions, symbol_seq_t* res) {
+    return fft_transform_cycl_parallel(gf, NULL, NULL, f, positions, res);
+}
+
+int fft_transform_cycl_parallel(GF_t* gf, pool_t* pool, workspace_t* ws, const symbol_seq_t* f,
+                                const uint16_t* positions, symbol_seq_t* res) {
     assert(gf != NULL);
     assert(f != NULL);
     assert(positions != NULL);
     assert(res != NULL);
     assert(f->symbol_size == res->symbol_size);
 
-    symbol_seq_t* u;
-    size_t symbol_size = f->symbol_size;
+    _fft_cycl_task_t task;
+    bool* calculated;
+    coset_t* cosets;
+    uint16_t cosets_cnt = 0;
+    int err;
 
-    bool* calculated = (bool*)calloc(res->length, sizeof(bool));
-    if (!calculated)
-        return 1;
+    if (!ws) {
+        ws = workspace_create();
+        if (!ws)
+            return 1;
+
+        err = fft_transform_cycl_parallel(gf, pool, ws, f, positions, res);
+        workspace_destroy(ws);
 
-    u = seq_create(CC_MAX_COSET_SIZE, symbol_size);
-    if (!u) {
-        free(calculated);
+        return err;
+    }
+
+    size_t mark = workspace_mark(ws);
+
+    calculated = (bool*)workspace_alloc(ws, res->length * sizeof(bool));
+    cosets = (coset_t*)workspace_alloc(ws, res->length * sizeof(coset_t));
+    if (!calculated || !cosets) {
+        workspace_release(ws, mark);
         return 1;
     }
+    memset((void*)calculated, 0, res->length * sizeof(bool));
 
+    // cosets that contain components [0; res->length)
     for (uint16_t s = 0; s < res->length; ++s) {
         if (calculated[s])
             continue;
 
         uint8_t m = cc_get_coset_size(s);
 
-        for (uint8_t t = 0; t < m; ++t)
-            memset((void*)u->symbols[t]->data, 0, symbol_size);
-
-        for (uint16_t i = 0; i < f->length; ++i) {
-            uint16_t repr = gf_get_normal_repr(gf, m, (s * positions[i]) % N);
-
-            for (uint8_t t = 0; t < m; ++t) {
-                if (repr & (1 << t))
-                    gf_add((void*)u->symbols[t]->data, (void*)f->symbols[i]->data, symbol_size);
-            }
-        }
-
         uint16_t idx = s;
         for (uint8_t j = 0; j < m; ++j) {
-            if (idx < res->length) {
-                memset((void*)res->symbols[idx]->data, 0, symbol_size);
-
-                for (uint8_t t = 0; t < m; ++t) {
-                    element_t coef = gf_get_normal_basis_element(gf, m, (j + t) % m);
-                    gf_madd(gf, (void*)res->symbols[idx]->data, coef, (void*)u->symbols[t]->data, symbol_size);
-                }
-
+            if (idx < res->length)
                 calculated[idx] = true;
-            }
-
             idx = NEXT_COSET_ELEMENT(idx);
         }
 
-        assert(idx == s);
+        cosets[cosets_cnt].leader = s;
+        cosets[cosets_cnt++].size = m;
     }
 
-    seq_destroy(u);
-    free(calculated);
+    task.gf = gf;
+    task.f = f;
+    task.positions = positions;
+    task.cosets = cosets;
+    task.first_idx = NULL;
+    task.dst_idx = NULL;
+    task.scales = NULL;
+    task.cosets_cnt = cosets_cnt;
+    task.res = res;
 
-    return 0;
+    err = _fft_cycl_run(pool, ws, &task);
+
+    workspace_release(ws, mark);
+
+    return err;
 }
 
 // cppcheck-suppress unusedFunction
@@ -108,7 +613,7 @@ void fft_partial_transform(GF_t* gf, const symbol_seq_t* f, const uint16_t* comp
     assert(f->symbol_size == res->symbol_size);
 
     size_t symbol_size = f->symbol_size;
-    element_t* pow_table = gf->pow_table;
+    const element_t* pow_table = gf->pow_table;
     element_t coef;
 
     for (uint16_t res_idx = 0; res_idx < res->length; ++res_idx) {
@@ -125,53 +630,305 @@ void fft_partial_transform(GF_t* gf, const symbol_seq_t* f, const uint16_t* comp
 
 int fft_partial_transform_cycl(GF_t* gf, const symbol_seq_t* f, const coset_t* cosets, uint16_t cosets_cnt,
                                symbol_seq_t* res) {
+    return fft_partial_transform_cycl_parallel(gf, NULL, NULL, f, cosets, cosets_cnt, NULL, res);
+}
+
+int fft_partial_transform_cycl_parallel(GF_t* gf, pool_t* pool, workspace_t* ws, const symbol_seq_t* f,
+                                        const coset_t* cosets, uint16_t cosets_cnt, const element_t* scales,
+                                        symbol_seq_t* res) {
     assert(gf != NULL);
     assert(f != NULL);
     assert(cosets != NULL);
     assert(res != NULL);
     assert(f->symbol_size == res->symbol_size);
 
-    symbol_seq_t* u;
-    size_t symbol_size = f->symbol_size;
+    _fft_cycl_task_t task;
+    uint16_t* first_idx;
     uint16_t idx = 0;
+    int err;
+
+    if (!ws) {
+        ws = workspace_create();
+        if (!ws)
+            return 1;
+
+        err = fft_partial_transform_cycl_parallel(gf, pool, ws, f, cosets, cosets_cnt, scales, res);
+        workspace_destroy(ws);
 
-    u = seq_create(CC_MAX_COSET_SIZE, symbol_size);
-    if (!u)
+        return err;
+    }
+
+    size_t mark = workspace_mark(ws);
+
+    first_idx = (uint16_t*)workspace_alloc(ws, ((size_t)cosets_cnt + 1) * sizeof(uint16_t));
+    if (!first_idx)
         return 1;
 
-    for (const coset_t* end = cosets + cosets_cnt; cosets != end; ++cosets) {
-        coset_t coset = *cosets;
+    for (uint16_t c = 0; c < cosets_cnt; ++c) {
+        first_idx[c] = idx;
+        idx += cosets[c].size;
+    }
 
-        uint16_t s = N - coset.leader;
-        uint8_t m = coset.size;
+    assert(idx == res->length);
 
-        for (uint8_t t = 0; t < m; ++t)
-            memset((void*)u->symbols[t]->data, 0, symbol_size);
+    task.gf = gf;
+    task.f = f;
+    task.positions = NULL;
+    task.cosets = cosets;
+    task.first_idx = first_idx;
+    task.dst_idx = NULL;
+    task.scales = scales;
+    task.cosets_cnt = cosets_cnt;
+    task.res = res;
 
-        for (uint16_t i = 0; i < f->length; ++i) {
-            uint16_t repr = gf_get_normal_repr(gf, m, (s * i) % N);
+    err = _fft_cycl_run(pool, ws, &task);
 
-            for (uint8_t t = 0; t < m; ++t) {
-                if (repr & (1 << t))
-                    gf_add((void*)u->symbols[t]->data, f->symbols[i]->data, symbol_size);
-            }
+    workspace_release(ws, mark);
+
+    return err;
+}
+
+/**
+ * @brief Compare keys of components (see fft_partial_transform_cycl_components_parallel(...)).
+ */
+static int _fft_compare_keys(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a;
+    uint32_t y = *(const uint32_t*)b;
+
+    return (x > y) - (x < y);
+}
+
+int fft_partial_transform_cycl_components(GF_t* gf, const symbol_seq_t* f, const uint16_t* components,
+                                          symbol_seq_t* res) {
+    return fft_partial_transform_cycl_components_parallel(gf, NULL, NULL, f, components, NULL, res);
+}
+
+int fft_partial_transform_cycl_components_parallel(GF_t* gf, pool_t* pool, workspace_t* ws, const symbol_seq_t* f,
+                                                   const uint16_t* components, const element_t* scales,
+                                                   symbol_seq_t* res) {
+    assert(gf != NULL);
+    assert(f != NULL);
+    assert(components != NULL);
+    assert(res != NULL);
+    assert(f->symbol_size == res->symbol_size);
+
+    _fft_cycl_task_t task;
+    uint32_t* keys;
+    coset_t* cosets;
+    uint16_t* first_idx;
+    uint16_t* dst_idx;
+    uint16_t cosets_cnt = 0;
+    uint32_t dst_cnt = 0;
+    uint16_t cnt = res->length;
+    int err;
+
+    if (!ws) {
+        ws = workspace_create();
+        if (!ws)
+            return 1;
+
+        err = fft_partial_transform_cycl_components_parallel(gf, pool, ws, f, components, scales, res);
+        workspace_destroy(ws);
+
+        return err;
+    }
+
+    size_t mark = workspace_mark(ws);
+
+    // keys[i] = (leader << 16) | i, where leader - leader of cyclotomic coset of components[i]
+    keys = (uint32_t*)workspace_alloc(ws, cnt * sizeof(uint32_t));
+    cosets = (coset_t*)workspace_alloc(ws, cnt * sizeof(coset_t));
+    first_idx = (uint16_t*)workspace_alloc(ws, cnt * sizeof(uint16_t));
+    dst_idx = (uint16_t*)workspace_alloc(ws, (size_t)cnt * CC_MAX_COSET_SIZE * sizeof(uint16_t));
+    if (!keys || !cosets || !first_idx || !dst_idx) {
+        workspace_release(ws, mark);
+        return 1;
+    }
+
+    for (uint16_t i = 0; i < cnt; ++i) {
+        uint16_t leader = components[i];
+
+        for (uint16_t c = NEXT_COSET_ELEMENT(components[i]); c != components[i]; c = NEXT_COSET_ELEMENT(c))
+            leader = MIN(leader, c);
+
+        keys[i] = ((uint32_t)leader << 16) | i;
+    }
+
+    qsort((void*)keys, cnt, sizeof(uint32_t), _fft_compare_keys);
+
+    for (uint16_t i = 0; i < cnt; ++i) {
+        uint16_t leader = (uint16_t)(keys[i] >> 16);
+        uint16_t res_idx = (uint16_t)keys[i];
+
+        if (cosets_cnt == 0 || cosets[cosets_cnt - 1].leader != leader) {
+            uint8_t m = cc_get_coset_size(leader);
+
+            cosets[cosets_cnt].leader = leader;
+            cosets[cosets_cnt].size = m;
+            first_idx[cosets_cnt++] = (uint16_t)dst_cnt;
+
+            for (uint8_t j = 0; j < m; ++j)
+                dst_idx[dst_cnt++] = FFT_CYCL_DISCARDED;
+        }
+
+        // j-th element of coset is (leader * 2^j)
+        uint8_t j = 0;
+        for (uint16_t c = leader; c != components[res_idx]; c = NEXT_COSET_ELEMENT(c))
+            ++j;
+
+        assert(dst_idx[first_idx[cosets_cnt - 1] + j] == FFT_CYCL_DISCARDED);
+        dst_idx[first_idx[cosets_cnt - 1] + j] = res_idx;
+    }
+
+    task.gf = gf;
+    task.f = f;
+    task.positions = NULL;
+    task.cosets = cosets;
+    task.first_idx = first_idx;
+    task.dst_idx = dst_idx;
+    task.scales = scales;
+    task.cosets_cnt = cosets_cnt;
+    task.res = res;
+
+    err = _fft_cycl_run(pool, ws, &task);
+
+    workspace_release(ws, mark);
+
+    return err;
+}
+
+/**
+ * @brief Compute product modulo FFT_NTT_PRIME.
+ */
+static inline uint32_t _fft_ntt_mul(uint32_t a, uint32_t b) {
+    return (uint32_t)((uint64_t)a * b % FFT_NTT_PRIME);
+}
+
+/**
+ * @brief Compute power modulo FFT_NTT_PRIME.
+ */
+static uint32_t _fft_ntt_pow(uint32_t a, uint32_t e) {
+    uint32_t res = 1;
+
+    for (; e > 0; e >>= 1) {
+        if (e & 1)
+            res = _fft_ntt_mul(res, a);
+        a = _fft_ntt_mul(a, a);
+    }
+
+    return res;
+}
+
+/**
+ * @brief Compute number theoretic transform of length FFT_NTT_LENGTH in place: \f$A_j = \sum_i a_i w^{ij}\f$.
+ * @details Inverse transform is the same transform followed by reversal of \f$A_1, \dots, A_{L-1}\f$ and division by
+ * the length L.
+ *
+ * @param a sequence of residues modulo FFT_NTT_PRIME.
+ * @param roots consecutive powers of primitive root of unity w of degree FFT_NTT_LENGTH, FFT_NTT_LENGTH / 2 of them.
+ */
+static void _fft_ntt(uint32_t* a, const uint32_t* roots) {
+    for (uint32_t i = 1, j = 0; i < FFT_NTT_LENGTH; ++i) {
+        uint32_t bit = FFT_NTT_LENGTH >> 1;
+
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+
+        if (i < j) {
+            uint32_t tmp = a[i];
+            a[i] = a[j];
+            a[j] = tmp;
         }
+    }
 
-        for (uint8_t j = 0; j < m; ++j, ++idx) {
-            assert(idx < res->length);
+    for (uint32_t len = 2; len <= FFT_NTT_LENGTH; len <<= 1) {
+        uint32_t half = len / 2;
+        uint32_t step = FFT_NTT_LENGTH / len;
 
-            memset((void*)res->symbols[idx]->data, 0, symbol_size);
+        for (uint32_t i = 0; i < FFT_NTT_LENGTH; i += len) {
+            for (uint32_t j = 0; j < half; ++j) {
+                uint32_t u = a[i + j];
+                uint32_t v = _fft_ntt_mul(a[i + j + half], roots[j * step]);
+                uint64_t sum = (uint64_t)u + v;
 
-            for (uint8_t t = 0; t < m; ++t) {
-                element_t coef = gf_get_normal_basis_element(gf, m, (j + t) % m);
-                gf_madd(gf, (void*)res->symbols[idx]->data, coef, (void*)u->symbols[t]->data, symbol_size);
+                a[i + j] = (uint32_t)(sum >= FFT_NTT_PRIME ? sum - FFT_NTT_PRIME : sum);
+                a[i + j + half] = u >= v ? u - v : FFT_NTT_PRIME - (v - u);
             }
         }
     }
+}
 
-    assert(idx == res->length);
+int fft_get_locator_logs(GF_t* gf, workspace_t* ws, const uint16_t* positions, uint16_t positions_cnt, uint16_t* res) {
+    assert(gf != NULL);
+    assert(positions != NULL || positions_cnt == 0);
+    assert(res != NULL);
 
-    seq_destroy(u);
+    const element_t* pow_table = gf->pow_table;
+    const uint16_t* log_table = gf->log_table;
+    // sum of logarithms over all d != 0 is log of the product of all elements except 0 and 1, it is 0 (mod N), so
+    // for many positions the sum over the complement is computed and negated
+    bool complement = positions_cnt > N / 2;
+    uint32_t* indicator;
+    uint32_t* logs;
+    uint32_t* roots;
+    uint32_t root;
+    uint32_t length_inv;
+    int err;
+
+    if (!ws) {
+        ws = workspace_create();
+        if (!ws)
+            return 1;
+
+        err = fft_get_locator_logs(gf, ws, positions, positions_cnt, res);
+        workspace_destroy(ws);
+
+        return err;
+    }
+
+    size_t mark = workspace_mark(ws);
+
+    indicator = (uint32_t*)workspace_alloc(ws, (size_t)FFT_NTT_LENGTH * 5 / 2 * sizeof(uint32_t));
+    if (!indicator)
+        return 1;
+    logs = indicator + FFT_NTT_LENGTH;
+    roots = logs + FFT_NTT_LENGTH;
+
+    for (uint32_t x = 0; x < FFT_NTT_LENGTH; ++x)
+        indicator[x] = (x < N && complement) ? 1 : 0;
+    for (uint16_t i = 0; i < positions_cnt; ++i)
+        indicator[positions[i]] = complement ? 0 : 1;
+
+    // logs[u] = log(1 + alpha^{-u}), so that convolution gives sum of log(1 + alpha^{e-j})
+    logs[0] = 0;
+    for (uint32_t u = 1; u < FFT_NTT_LENGTH; ++u)
+        logs[u] = u < N ? log_table[1 ^ pow_table[N - u]] : 0;
+
+    root = _fft_ntt_pow(FFT_NTT_PRIMITIVE_ROOT, (FFT_NTT_PRIME - 1) / FFT_NTT_LENGTH);
+    roots[0] = 1;
+    for (uint32_t i = 1; i < FFT_NTT_LENGTH / 2; ++i)
+        roots[i] = _fft_ntt_mul(roots[i - 1], root);
+
+    _fft_ntt(indicator, roots);
+    _fft_ntt(logs, roots);
+
+    for (uint32_t x = 0; x < FFT_NTT_LENGTH; ++x)
+        indicator[x] = _fft_ntt_mul(indicator[x], logs[x]);
+
+    _fft_ntt(indicator, roots);
+
+    // linear convolution c_x = indicator[(L - x) mod L] / L is folded modulo N
+    length_inv = _fft_ntt_pow(FFT_NTT_LENGTH, FFT_NTT_PRIME - 2);
+    for (uint32_t j = 0; j < N; ++j) {
+        uint32_t sum = _fft_ntt_mul(indicator[(FFT_NTT_LENGTH - j) % FFT_NTT_LENGTH], length_inv) % N;
+        sum += _fft_ntt_mul(indicator[FFT_NTT_LENGTH - j - N], length_inv) % N;
+        sum %= N;
+
+        res[j] = (uint16_t)(complement ? (N - sum) % N : sum);
+    }
+
+    workspace_release(ws, mark);
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,255 @@
+/**
+ * @file gen_tables.c
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief Build time generator of rs/tables.h definitions.
+ * @details Usage: gen_tables <output file>. Computes Galois field and cyclotomic coset tables and writes them as
+ * constant arrays to the C source file.
+ * @date 2024-03-20
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include <rs/tables.h>
+
+/**
+ * @brief Index in normal_bases array of the first basis element for the specified subfield.
+ */
+#define GEN_NORMAL_BASES_FIRST_IDX_BY_M(_m) ((_m)-1)
+
+/**
+ * @brief Number of values written on one line of the generated file.
+ */
+#define GEN_VALUES_PER_LINE 16
+
+/**
+ * @brief Normal bases of all GF(65536) subfields.
+ * @details Basis of GF(2^m) starts from index (m - 1).
+ */
+static const element_t g_normal_bases[GF_NORMAL_BASES_ELEMENTS] = {
+    1,                                                          // GF(2)
+    44234, 44235,                                               // GF(4)
+    10800, 47860, 34555, 5694,                                  // GF(16)
+    16402, 53598, 44348, 63986, 22060, 64366, 6088,  32521,     // GF(256)
+    2048,  2880,  7129,  30616, 2643,  6897,  29685, 7378,      // GF(65536)
+    30100, 2743,  20193, 36223, 24055, 41458, 41014, 61451,
+};
+
+static element_t g_pow[(N << 1) - 1];
+static uint16_t g_log[GF_FIELD_SIZE];
+static uint16_t g_normal_repr[GF_NORMAL_REPR_ELEMENTS];
+static uint16_t g_cc_leaders[CC_COSETS_CNT];
+static element_t g_cantor_subspace[AFFT_BASIS_SIZE * AFFT_BASIS_SIZE];
+static bool g_processed[N];
+
+static void _gen_fill_pow_log() {
+    poly_t cur_poly = 1;
+
+    for (uint16_t i = 0; i < N; ++i) {
+        g_pow[i] = (element_t)cur_poly;
+        g_log[g_pow[i]] = i;
+
+        cur_poly <<= 1;
+        if (cur_poly & GF_FIELD_SIZE)
+            cur_poly ^= GF_PRIMITIVE_POLY;
+    }
+
+    for (uint32_t i = N; i < (N << 1) - 1; ++i)
+        g_pow[i] = g_pow[i - N];
+}
+
+static int _gen_fill_normal_repr() {
+    uint16_t* normal_repr = g_normal_repr;
+
+    for (uint8_t i = 0; i < CC_COSET_SIZES_CNT; ++i) {
+        uint8_t m = 1 << i; // subfield power
+        const element_t* normal_basis = g_normal_bases + GEN_NORMAL_BASES_FIRST_IDX_BY_M(m);
+
+        for (uint32_t repr = 1; repr != (1u << m); ++repr) {
+            element_t elem = 0;
+            for (uint8_t j = 0; j < m; ++j) {
+                if (repr & (1u << j))
+                    elem ^= normal_basis[j];
+            }
+
+            if (elem == 0 || g_log[elem] % GF_SUBFIELD_GENERATOR_POWER(m) != 0)
+                return 1; // not a basis of the subfield
+
+            uint16_t d = g_log[elem] / GF_SUBFIELD_GENERATOR_POWER(m);
+            if (normal_repr[d] != 0)
+                return 1; // not a basis
+
+            normal_repr[d] = (uint16_t)repr;
+        }
+
+        normal_repr += (1u << m) - 1;
+    }
+
+    return normal_repr == g_normal_repr + GF_NORMAL_REPR_ELEMENTS ? 0 : 1;
+}
+
+static int _gen_fill_cc_leaders() {
+    static const uint16_t leaders_cnt[CC_COSET_SIZES_CNT] = {
+        CC_LEADERS_1_CNT, CC_LEADERS_2_CNT, CC_LEADERS_4_CNT, CC_LEADERS_8_CNT, CC_LEADERS_16_CNT};
+    uint16_t first[CC_COSET_SIZES_CNT]; // first[i] - index of the first leader of coset of size 2^i
+    uint16_t idx[CC_COSET_SIZES_CNT] = {0};
+
+    first[0] = 0;
+    for (uint8_t i = 1; i < CC_COSET_SIZES_CNT; ++i)
+        first[i] = first[i - 1] + leaders_cnt[i - 1];
+
+    for (uint16_t s = 0; s < N; ++s) {
+        if (g_processed[s])
+            continue;
+        g_processed[s] = true;
+
+        uint16_t cur_coset_elem = NEXT_COSET_ELEMENT(s);
+        uint8_t coset_size;
+        for (coset_size = 1; coset_size <= CC_MAX_COSET_SIZE; ++coset_size) {
+            if (cur_coset_elem == s)
+                break;
+            g_processed[cur_coset_elem] = true;
+            cur_coset_elem = NEXT_COSET_ELEMENT(cur_coset_elem);
+        }
+
+        uint8_t i = 0;
+        while (i < CC_COSET_SIZES_CNT && (1 << i) != coset_size)
+            ++i;
+
+        if (i == CC_COSET_SIZES_CNT || idx[i] == leaders_cnt[i])
+            return 1;
+
+        g_cc_leaders[first[i] + idx[i]++] = s;
+    }
+
+    for (uint8_t i = 0; i < CC_COSET_SIZES_CNT; ++i) {
+        if (idx[i] != leaders_cnt[i])
+            return 1;
+    }
+
+    return 0;
+}
+
+static element_t _gen_mul(element_t a, element_t b) {
+    if (a == 0 || b == 0)
+        return 0;
+    return g_pow[g_log[a] + g_log[b]];
+}
+
+static int _gen_fill_cantor_subspace() {
+    element_t* basis = g_cantor_subspace; // the first row: s_0(v_b) = v_b
+
+    // v_0 = 1, v_i - root of x^2 + x = v_{i-1}
+    basis[0] = 1;
+    for (uint8_t b = 1; b < AFFT_BASIS_SIZE; ++b) {
+        uint32_t x = 0;
+        while (x < GF_FIELD_SIZE && (_gen_mul((element_t)x, (element_t)x) ^ x) != basis[b - 1])
+            ++x;
+
+        if (x == GF_FIELD_SIZE)
+            return 1;
+        basis[b] = (element_t)x;
+    }
+
+    for (uint8_t i = 1; i < AFFT_BASIS_SIZE; ++i) {
+        const element_t* prev = g_cantor_subspace + (i - 1) * AFFT_BASIS_SIZE;
+        element_t* cur = g_cantor_subspace + i * AFFT_BASIS_SIZE;
+
+        for (uint8_t b = 0; b < AFFT_BASIS_SIZE; ++b)
+            cur[b] = _gen_mul(prev[b], prev[b]) ^ prev[b];
+    }
+
+    for (uint8_t i = 0; i < AFFT_BASIS_SIZE; ++i) {
+        for (uint8_t b = 0; b <= i; ++b) {
+            if (g_cantor_subspace[i * AFFT_BASIS_SIZE + b] != (b == i ? 1 : 0))
+                return 1; // s_i does not vanish on span(v_0, ..., v_{i-1}) or s_i(v_i) != 1
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Write array values.
+ *
+ * @param file output file.
+ * @param values array values.
+ * @param cnt number of values.
+ */
+static void _gen_write_values(FILE* file, const uint16_t* values, size_t cnt) {
+    for (size_t i = 0; i < cnt; ++i) {
+        if (i % GEN_VALUES_PER_LINE == 0)
+            fputs("    ", file);
+        fprintf(file, "%u,", (unsigned)values[i]);
+        fputc((i % GEN_VALUES_PER_LINE == GEN_VALUES_PER_LINE - 1 || i + 1 == cnt) ? '\n' : ' ', file);
+    }
+}
+
+static void _gen_write(FILE* file) {
+    fputs("/* Generated by gen_tables. Do not edit. */\n\n#include <rs/tables.h>\n\n", file);
+
+    fputs("const element_t tables_pow[(N << 1) - 1] = {\n", file);
+    _gen_write_values(file, g_pow, (N << 1) - 1);
+    fputs("};\n\n", file);
+
+    fputs("const uint16_t tables_log[GF_FIELD_SIZE] = {\n", file);
+    _gen_write_values(file, g_log, GF_FIELD_SIZE);
+    fputs("};\n\n", file);
+
+    fputs("const element_t tables_normal_bases[GF_NORMAL_BASES_ELEMENTS] = {\n", file);
+    _gen_write_values(file, g_normal_bases, GF_NORMAL_BASES_ELEMENTS);
+    fputs("};\n\n", file);
+
+    fputs("const uint16_t tables_normal_repr[GF_NORMAL_REPR_ELEMENTS] = {\n", file);
+    _gen_write_values(file, g_normal_repr, GF_NORMAL_REPR_ELEMENTS);
+    fputs("};\n\n", file);
+
+    fputs("const uint16_t tables_cc_leaders[CC_COSETS_CNT] = {\n", file);
+    _gen_write_values(file, g_cc_leaders, CC_COSETS_CNT);
+    fputs("};\n\n", file);
+
+    fputs("const element_t tables_cantor_subspace[AFFT_BASIS_SIZE * AFFT_BASIS_SIZE] = {\n", file);
+    _gen_write_values(file, g_cantor_subspace, AFFT_BASIS_SIZE * AFFT_BASIS_SIZE);
+    fputs("};\n", file);
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s <output file>\n", argv[0]);
+        return 1;
+    }
+
+    _gen_fill_pow_log();
+
+    if (_gen_fill_normal_repr()) {
+        fprintf(stderr, "ERROR: normal bases constants are not normal bases\n");
+        return 1;
+    }
+
+    if (_gen_fill_cc_leaders()) {
+        fprintf(stderr, "ERROR: unexpected number of cyclotomic cosets\n");
+        return 1;
+    }
+
+    if (_gen_fill_cantor_subspace()) {
+        fprintf(stderr, "ERROR: can't build Cantor basis\n");
+        return 1;
+    }
+
+    FILE* file = fopen(argv[1], "w");
+    if (!file) {
+        fprintf(stderr, "ERROR: can't open %s\n", argv[1]);
+        return 1;
+    }
+
+    _gen_write(file);
+
+    if (fclose(file)) {
+        fprintf(stderr, "ERROR: can't write %s\n", argv[1]);
+        return 1;
+    }
+
+    return 0;
+}
@@ -12,108 +12,400 @@
 #include <string.h>
 
 #include <rs/gf65536.h>
+#include <rs/gf65536_simd.h>
+#include <rs/tables.h>
 
 /**
  * @brief Index in normal_bases array of the first basis element for the specified subfield.
  */
 #define GF_NORMAL_BASES_FIRST_IDX_BY_M(_m) ((_m)-1)
 
-static inline void _gf_fill_normal_bases(element_t* normal_bases) {
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(1) + 0] = 1;
-
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(2) + 0] = 44234;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(2) + 1] = 44235;
-
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(4) + 0] = 10800;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(4) + 1] = 47860;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(4) + 2] = 34555;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(4) + 3] = 5694;
-
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(8) + 0] = 16402;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(8) + 1] = 53598;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(8) + 2] = 44348;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(8) + 3] = 63986;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(8) + 4] = 22060;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(8) + 5] = 64366;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(8) + 6] = 6088;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(8) + 7] = 32521;
-
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 0] = 2048;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 1] = 2880;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 2] = 7129;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 3] = 30616;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 4] = 2643;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 5] = 6897;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 6] = 29685;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 7] = 7378;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 8] = 30100;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 9] = 2743;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 10] = 20193;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 11] = 36223;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 12] = 24055;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 13] = 41458;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 14] = 41014;
-    normal_bases[GF_NORMAL_BASES_FIRST_IDX_BY_M(16) + 15] = 61451;
+/**
+ * @brief Index in normal_bases_tables array of the first table for the specified subfield.
+ */
+#define GF_NORMAL_BASES_FIRST_TABLE_IDX_BY_M(_m) (((_m)-1) << 1)
+
+/**
+ * @brief Minimal symbol size for which scalar kernels are used instead of logarithm lookups.
+ * @details Building of scalar multiplication tables costs about as much as 256 logarithm lookups.
+ */
+#define GF_SCALAR_TABLES_MIN_SYMBOL_SIZE 768
+
+/**
+ * @brief Build Karatsuba algorithm of multiplication of polynomial with constant coefficients B by polynomial V.
+ * @details \f$B V = P_0 + x^h (P_0 + P_1 + P_2) + x^{2h} P_1\f$, where \f$P_0 = B_{lo} V_{lo}\f$,
+ * \f$P_1 = B_{hi} V_{hi}\f$ and \f$P_2 = (B_{lo} + B_{hi}) (V_{lo} + V_{hi})\f$ are computed recursively.
+ *
+ * @param b polynomial coefficients.
+ * @param len polynomial length (power of 2).
+ * @param coefs products constants (result will be placed here).
+ * @param inputs bit masks of V coefficients summed for products (result will be placed here).
+ * @param outputs bit masks of product coefficients the products are added to (result will be placed here).
+ * @return number of products.
+ */
+static uint8_t _gf_build_karatsuba(const element_t* b, uint8_t len, element_t* coefs, uint16_t* inputs,
+                                   uint32_t* outputs) {
+    if (len == 1) {
+        coefs[0] = b[0];
+        inputs[0] = 1;
+        outputs[0] = 1;
+        return 1;
+    }
+
+    uint8_t h = len >> 1;
+    element_t sums[CC_MAX_COSET_SIZE >> 1];
+
+    for (uint8_t i = 0; i < h; ++i)
+        sums[i] = b[i] ^ b[h + i];
+
+    uint8_t cnt = _gf_build_karatsuba(b, h, coefs, inputs, outputs);
+
+    for (uint8_t k = 0; k < cnt; ++k)
+        outputs[k] ^= outputs[k] << h;
+
+    uint8_t first = cnt;
+    cnt += _gf_build_karatsuba(b + h, h, coefs + cnt, inputs + cnt, outputs + cnt);
+
+    for (uint8_t k = first; k < cnt; ++k) {
+        inputs[k] <<= h;
+        outputs[k] = (outputs[k] << len) ^ (outputs[k] << h);
+    }
+
+    first = cnt;
+    cnt += _gf_build_karatsuba(sums, h, coefs + cnt, inputs + cnt, outputs + cnt);
+
+    for (uint8_t k = first; k < cnt; ++k) {
+        inputs[k] |= inputs[k] << h;
+        outputs[k] <<= h;
+    }
+
+    return cnt;
+}
+
+/**
+ * @brief Prepare short cyclic convolution algorithm with normal basis of the subfield GF(2^m).
+ * @details \f$A_j = \sum_s \beta_{j-s} V_s\f$, where \f$V_s = B_{-s}\f$ (indices modulo m), is the product of
+ * polynomials \f$\sum_i \beta_i x^i\f$ and V modulo \f$x^m - 1\f$.
+ *
+ * @param gf Galois field data.
+ * @param alg algorithm (result will be placed here).
+ * @param tables multiplication tables of algorithm constants (result will be placed here).
+ * @param m subfield power.
+ * @return number of filled multiplication tables.
+ */
+static uint8_t _gf_prepare_normal_basis_convolution(const GF_t* gf, gf_bilinear_t* alg, gf_coef_tables_t* tables,
+                                                    uint8_t m) {
+    element_t coefs[GF_BILINEAR_MAX_PRODUCTS];
+    uint16_t inputs[GF_BILINEAR_MAX_PRODUCTS];
+    uint32_t outputs[GF_BILINEAR_MAX_PRODUCTS];
+    uint8_t cnt = _gf_build_karatsuba(gf->normal_bases + GF_NORMAL_BASES_FIRST_IDX_BY_M(m), m, coefs, inputs, outputs);
+    uint16_t terms_cnt = 0;
+
+    alg->tables = tables;
+    alg->sources_cnt = m;
+    alg->products_cnt = cnt;
+    alg->destinations_cnt = m;
+
+    for (uint8_t k = 0; k < cnt; ++k) {
+        gf_prepare_coef(gf, tables + k, coefs[k]);
+
+        alg->inputs[k] = 0;
+        for (uint8_t s = 0; s < m; ++s) {
+            if (inputs[k] & (1u << s))
+                alg->inputs[k] |= 1u << ((m - s) & (m - 1));
+        }
+
+        outputs[k] = (outputs[k] & ((1u << m) - 1)) ^ (outputs[k] >> m); // reduction modulo x^m - 1
+    }
+
+    for (uint8_t j = 0; j < m; ++j) {
+        alg->terms_cnt[j] = 0;
+
+        for (uint8_t k = 0; k < cnt; ++k) {
+            if (outputs[k] & (1u << j)) {
+                assert(terms_cnt < GF_BILINEAR_MAX_TERMS);
+                alg->terms[terms_cnt++] = k;
+                ++alg->terms_cnt[j];
+            }
+        }
+    }
+
+    return cnt;
 }
 
 GF_t* gf_create() {
     GF_t* gf;
 
-    gf = (GF_t*)malloc(sizeof(GF_t));
+    // multiplication tables in GF_t are aligned to the cache line, malloc(...) does not guarantee it
+    gf = (GF_t*)aligned_alloc(_Alignof(GF_t), sizeof(GF_t));
     if (!gf)
         return NULL;
     memset((void*)gf, 0, sizeof(GF_t));
 
-    gf->normal_repr_by_subfield[1] = gf->_normal_repr_by_subfield_memory;
-    for (uint8_t i = 1; i < CC_COSET_SIZES_CNT; ++i)
-        gf->normal_repr_by_subfield[1 << i] = gf->normal_repr_by_subfield[1 << (i - 1)] + N;
+    gf->pow_table = tables_pow;
+    gf->log_table = tables_log;
+    gf->normal_bases = tables_normal_bases;
+
+    const uint16_t* normal_repr = tables_normal_repr;
+    for (uint8_t m = 1; m <= CC_MAX_COSET_SIZE; m <<= 1) {
+        gf->normal_repr_by_subfield[m] = normal_repr;
+        normal_repr += (1u << m) - 1;
+    }
+
+    gf_set_tier(gf, cpu_select_tier());
+
+    return gf;
+}
+
+void gf_destroy(GF_t* gf) {
+    assert(gf != NULL);
+
+    free(gf);
+}
+
+/**
+ * @brief Compute the sum of 2 elements in Galois field without SIMD instructions.
+ *
+ * @param a first element (result will be placed here).
+ * @param b second element.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+static void _gf_add_scalar(void* a, const void* b, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
 
-    _gf_fill_normal_bases(gf->normal_bases);
+    uint64_t* data64_1 = (uint64_t*)a;
+    uint64_t* data64_2 = (uint64_t*)b;
 
-    element_t* pow_table = gf->pow_table;
-    uint16_t** normal_repr_by_subfield = gf->normal_repr_by_subfield;
-    uint16_t* log_table = gf->log_table;
-    poly_t cur_poly = 1;
+    for (const uint64_t* end64_1 = data64_1 + symbol_size / sizeof(uint64_t); data64_1 != end64_1;
+         ++data64_1, ++data64_2)
+        *data64_1 ^= *data64_2;
 
-    for (uint16_t i = 0; i < N; ++i) {
-        pow_table[i] = (element_t)cur_poly;
-        log_table[pow_table[i]] = i;
+    element_t* data_1 = (element_t*)data64_1;
+    element_t* data_2 = (element_t*)data64_2;
 
-        cur_poly <<= 1;
-        if (cur_poly & GF_FIELD_SIZE)
-            cur_poly ^= GF_PRIMITIVE_POLY;
+    for (const element_t* end_1 = (element_t*)a + symbol_size / sizeof(element_t); data_1 != end_1; ++data_1, ++data_2)
+        *data_1 ^= *data_2;
+}
+
+/**
+ * @brief Compute multiplication of element and coefficient in Galois field without SIMD instructions.
+ *
+ * @param a element (result will be placed here).
+ * @param tables coefficient multiplication tables.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+static void _gf_mul_scalar(void* a, const gf_coef_tables_t* tables, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    const element_t* by_low_byte = tables->by_low_byte;
+    const element_t* by_high_byte = tables->by_high_byte;
+    element_t* data = (element_t*)a;
+
+    for (const element_t* end = data + symbol_size / sizeof(element_t); data != end; ++data) {
+        element_t val = *data;
+        *data = by_low_byte[val & 0xFF] ^ by_high_byte[val >> 8];
     }
+}
+
+/**
+ * @brief Compute "A += c * B" expression in Galois field without SIMD instructions.
+ *
+ * @param a first element (result will be placed here).
+ * @param tables coefficient multiplication tables.
+ * @param b second element.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+static void _gf_madd_scalar(void* a, const gf_coef_tables_t* tables, const void* b, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
 
-    for (uint32_t i = N; i < (N << 1) - 1; ++i)
-        pow_table[i] = pow_table[i - N];
+    const element_t* by_low_byte = tables->by_low_byte;
+    const element_t* by_high_byte = tables->by_high_byte;
+    element_t* data_1 = (element_t*)a;
+    const element_t* data_2 = (const element_t*)b;
 
-    for (uint8_t i = 0; i < CC_COSET_SIZES_CNT; ++i) {
-        uint8_t m = 1 << i; // cyclotomic coset size
-        element_t* normal_basis = gf->normal_bases + GF_NORMAL_BASES_FIRST_IDX_BY_M(m);
+    for (const element_t* end_1 = data_1 + symbol_size / sizeof(element_t); data_1 != end_1; ++data_1, ++data_2) {
+        element_t val_2 = *data_2;
+        *data_1 ^= by_low_byte[val_2 & 0xFF] ^ by_high_byte[val_2 >> 8];
+    }
+}
 
-        memset((void*)normal_repr_by_subfield[m], 0, N * sizeof(uint16_t));
+/**
+ * @brief Compute "A += c_0 * B_0 + ... + c_{cnt-1} * B_{cnt-1}" expression in Galois field without SIMD
+ * instructions.
+ *
+ * @param a destination element (result will be placed here).
+ * @param tables coefficients multiplication tables.
+ * @param b source elements.
+ * @param cnt number of source elements.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+static void _gf_madd_multi_scalar(void* a, const gf_coef_tables_t* tables, const void* const* b, uint16_t cnt,
+                                  size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+    assert(cnt <= GF_MADD_MULTI_BATCH_SIZE);
 
-        for (uint32_t repr = 1; repr != (1 << m); ++repr) {
-            element_t elem = 0;
-            for (uint8_t j = 0; j < m; ++j) {
-                if (repr & (1 << j))
-                    elem ^= normal_basis[j];
-            }
+    element_t* data_1 = (element_t*)a;
+    size_t elements_cnt = symbol_size / sizeof(element_t);
 
-            assert(elem != 0);
-            assert(normal_repr_by_subfield[m][log_table[elem]] == 0);
+    for (size_t j = 0; j < elements_cnt; ++j) {
+        element_t acc = data_1[j];
 
-            normal_repr_by_subfield[m][log_table[elem]] = (uint16_t)repr;
+        for (uint16_t i = 0; i < cnt; ++i) {
+            element_t val_2 = ((const element_t*)b[i])[j];
+            acc ^= tables[i].by_low_byte[val_2 & 0xFF] ^ tables[i].by_high_byte[val_2 >> 8];
         }
+
+        data_1[j] = acc;
     }
+}
 
-    return gf;
+/**
+ * @brief Compute bilinear algorithm "A_j = s_j * sum_{k in terms_j} c_k * (sum_{t in inputs_k} B_t)" in Galois field
+ * without SIMD instructions.
+ *
+ * @param a destination elements (result will be placed here).
+ * @param alg bilinear algorithm.
+ * @param scales multiplication tables of destinations scale factors s_j or NULL (s_j = 1).
+ * @param b source elements.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+static void _gf_bilinear_scalar(void* const* a, const gf_bilinear_t* alg, const gf_coef_tables_t* scales,
+                                const void* const* b, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    element_t products[GF_BILINEAR_MAX_PRODUCTS];
+    size_t elements_cnt = symbol_size / sizeof(element_t);
+
+    for (size_t i = 0; i < elements_cnt; ++i) {
+        for (uint8_t k = 0; k < alg->products_cnt; ++k) {
+            const gf_coef_tables_t* tables = alg->tables + k;
+            element_t val = 0;
+
+            for (uint16_t inputs = alg->inputs[k]; inputs != 0; inputs &= inputs - 1)
+                val ^= ((const element_t*)b[__builtin_ctz(inputs)])[i];
+
+            products[k] = tables->by_low_byte[val & 0xFF] ^ tables->by_high_byte[val >> 8];
+        }
+
+        const uint8_t* term = alg->terms;
+
+        for (uint8_t j = 0; j < alg->destinations_cnt; ++j) {
+            element_t val = 0;
+
+            for (const uint8_t* end = term + alg->terms_cnt[j]; term != end; ++term)
+                val ^= products[*term];
+
+            if (scales)
+                val = scales[j].by_low_byte[val & 0xFF] ^ scales[j].by_high_byte[val >> 8];
+
+            ((element_t*)a[j])[i] = val;
+        }
+    }
 }
 
-void gf_destroy(GF_t* gf) {
+/**
+ * @brief Compute multiplication of element and coefficient in Galois field using logarithm lookups.
+ * @details Used for short symbols, for which building of multiplication tables does not pay off.
+ *
+ * @param gf pointer to Galois field data structure.
+ * @param a element (result will be placed here).
+ * @param coef coefficient (must not be 0).
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+static void _gf_mul_log(const GF_t* gf, void* a, element_t coef, size_t symbol_size) {
+    assert(coef != 0);
+
+    const element_t* pow_table_shifted = gf->pow_table + gf->log_table[coef];
+    const uint16_t* log_table = gf->log_table;
+    element_t* data = (element_t*)a;
+
+    for (const element_t* end = data + symbol_size / sizeof(element_t); data != end; ++data) {
+        element_t val = *data;
+        if (val != 0)
+            *data = pow_table_shifted[log_table[val]];
+    }
+}
+
+/**
+ * @brief Compute "A += c * B" expression in Galois field using logarithm lookups.
+ * @details Used for short symbols, for which building of multiplication tables does not pay off.
+ *
+ * @param gf pointer to Galois field data structure.
+ * @param a first element (result will be placed here).
+ * @param coef coefficient (must not be 0).
+ * @param b second element.
+ * @param symbol_size symbol size (must be divisible by 2).
+ */
+static void _gf_madd_log(const GF_t* gf, void* a, element_t coef, const void* b, size_t symbol_size) {
+    assert(coef != 0);
+
+    const element_t* pow_table_shifted = gf->pow_table + gf->log_table[coef];
+    const uint16_t* log_table = gf->log_table;
+    element_t* data_1 = (element_t*)a;
+    const element_t* data_2 = (const element_t*)b;
+
+    for (const element_t* end_1 = data_1 + symbol_size / sizeof(element_t); data_1 != end_1; ++data_1, ++data_2) {
+        element_t val_2 = *data_2;
+        if (val_2 != 0)
+            *data_1 ^= pow_table_shifted[log_table[val_2]];
+    }
+}
+
+void gf_set_tier(GF_t* gf, cpu_tier_t tier) {
     assert(gf != NULL);
+    assert(tier <= cpu_detect_tier());
+
+    gf->tier = tier;
+
+    switch (tier) {
+#ifdef CPU_X86
+    case CPU_TIER_AVX512BW:
+        gf->add = gf_add_avx512bw;
+        gf->mul = gf_mul_avx512bw;
+        gf->madd = gf_madd_avx512bw;
+        gf->madd_multi = gf_madd_multi_avx512bw;
+        gf->bilinear = gf_bilinear_avx512bw;
+        break;
+    case CPU_TIER_AVX2:
+        gf->add = gf_add_avx2;
+        gf->mul = gf_mul_avx2;
+        gf->madd = gf_madd_avx2;
+        gf->madd_multi = gf_madd_multi_avx2;
+        gf->bilinear = gf_bilinear_avx2;
+        break;
+    case CPU_TIER_SSSE3:
+        gf->add = gf_add_ssse3;
+        gf->mul = gf_mul_ssse3;
+        gf->madd = gf_madd_ssse3;
+        gf->madd_multi = gf_madd_multi_ssse3;
+        gf->bilinear = gf_bilinear_ssse3;
+        break;
+#endif
+    default:
+        gf->tier = CPU_TIER_SCALAR;
+        gf->add = _gf_add_scalar;
+        gf->mul = _gf_mul_scalar;
+        gf->madd = _gf_madd_scalar;
+        gf->madd_multi = _gf_madd_multi_scalar;
+        gf->bilinear = _gf_bilinear_scalar;
+        break;
+    }
 
-    free(gf);
+    gf_coef_tables_t* convolution_tables = gf->normal_bases_convolution_tables;
+
+    for (uint8_t m = 1; m <= CC_MAX_COSET_SIZE; m <<= 1) {
+        gf_coef_tables_t* tables = gf->normal_bases_tables + GF_NORMAL_BASES_FIRST_TABLE_IDX_BY_M(m);
+
+        for (uint8_t i = 0; i < m; ++i) {
+            gf_prepare_coef(gf, tables + i, gf_get_normal_basis_element(gf, m, i));
+            tables[m + i] = tables[i];
+        }
+
+        convolution_tables += _gf_prepare_normal_basis_convolution(
+            gf, gf->normal_bases_convolutions + __builtin_ctz(m), convolution_tables, m);
+    }
+
+    assert(convolution_tables == gf->normal_bases_convolution_tables + GF_NORMAL_BASES_CONVOLUTION_TABLES);
 }
 
 inline element_t gf_get_normal_basis_element(GF_t* gf, uint8_t m, uint8_t i) {
@@ -126,6 +418,16 @@ inline element_t gf_get_normal_basis_element(GF_t* gf, uint8_t m, uint8_t i) {
 inline uint16_t gf_get_normal_repr(GF_t* gf, uint8_t m, uint16_t d) {
     assert(gf != NULL);
 
+    if (d % GF_SUBFIELD_GENERATOR_POWER(m) != 0)
+        return 0;
+
+    return gf->normal_repr_by_subfield[m][(d % N) / GF_SUBFIELD_GENERATOR_POWER(m)];
+}
+
+inline uint16_t gf_get_normal_repr_reduced(GF_t* gf, uint8_t m, uint16_t d) {
+    assert(gf != NULL);
+    assert(d < (1u << m) - 1);
+
     return gf->normal_repr_by_subfield[m][d];
 }
 
@@ -135,7 +437,7 @@ element_t gf_mul_ee(GF_t* gf, element_t a, element_t b) {
     if (a == 0 || b == 0)
         return 0;
 
-    uint16_t* log_table = gf->log_table;
+    const uint16_t* log_table = gf->log_table;
 
     return gf->pow_table[(uint32_t)log_table[a] + (uint32_t)log_table[b]];
 }
@@ -147,29 +449,118 @@ element_t gf_div_ee(GF_t* gf, element_t a, element_t b) {
     if (a == 0)
         return 0;
 
-    uint16_t* log_table = gf->log_table;
+    const uint16_t* log_table = gf->log_table;
 
     return gf->pow_table[(N + (uint32_t)log_table[a] - (uint32_t)log_table[b]) % N];
 }
 
-void gf_add(void* a, const void* b, size_t symbol_size) {
-    assert(symbol_size % sizeof(element_t) == 0);
+void gf_mul_elements(const GF_t* gf, element_t* res, const element_t* a, const element_t* b, size_t cnt) {
+    assert(gf != NULL);
+    assert(res != NULL);
+    assert(a != NULL);
+    assert(b != NULL);
 
-    uint64_t* data64_1 = (uint64_t*)a;
-    uint64_t* data64_2 = (uint64_t*)b;
+    const element_t* pow_table = gf->pow_table;
+    const uint16_t* log_table = gf->log_table;
 
-    for (const uint64_t* end64_1 = data64_1 + symbol_size / sizeof(uint64_t); data64_1 != end64_1;
-         ++data64_1, ++data64_2)
-        *data64_1 ^= *data64_2;
+    for (size_t i = 0; i < cnt; ++i) {
+        element_t x = a[i];
+        element_t y = b[i];
+        element_t prod = pow_table[(uint32_t)log_table[x] + (uint32_t)log_table[y]];
 
-    element_t* data_1 = (element_t*)data64_1;
-    element_t* data_2 = (element_t*)data64_2;
+        res[i] = (x != 0 && y != 0) ? prod : 0;
+    }
+}
 
-    for (const element_t* end_1 = (element_t*)a + symbol_size / sizeof(element_t); data_1 != end_1; ++data_1, ++data_2)
-        *data_1 ^= *data_2;
+void gf_inv_elements(const GF_t* gf, element_t* res, const element_t* a, size_t cnt) {
+    assert(gf != NULL);
+    assert(res != NULL);
+    assert(a != NULL);
+
+    const element_t* pow_table = gf->pow_table;
+    const uint16_t* log_table = gf->log_table;
+
+    for (size_t i = 0; i < cnt; ++i) {
+        assert(a[i] != 0);
+        res[i] = pow_table[N - (uint32_t)log_table[a[i]]];
+    }
+}
+
+void gf_pow_elements(const GF_t* gf, element_t* res, uint16_t start, uint16_t step, size_t cnt) {
+    assert(gf != NULL);
+    assert(res != NULL);
+
+    const element_t* pow_table = gf->pow_table;
+    uint32_t e = start % N;
+
+    step %= N;
+
+    for (size_t i = 0; i < cnt; ++i) {
+        res[i] = pow_table[e];
+        e += step;
+        e -= (e >= N) ? N : 0;
+    }
+}
+
+void gf_prepare_coef(const GF_t* gf, gf_coef_tables_t* tables, element_t coef) {
+    assert(gf != NULL);
+    assert(tables != NULL);
+
+    tables->coef = coef;
+
+    element_t basis[16]; // basis[b] = coef * x^b
+
+    basis[0] = coef;
+    for (uint8_t b = 1; b < 16; ++b) {
+        element_t prev = basis[b - 1];
+        basis[b] = (element_t)(prev << 1);
+        if (prev & (GF_FIELD_SIZE >> 1))
+            basis[b] ^= (element_t)GF_PRIMITIVE_POLY;
+    }
+
+    if (gf->tier == CPU_TIER_SCALAR) {
+        // Multiplication is linear, so table of 2^(b+1) products is built from table of 2^b products.
+        tables->by_low_byte[0] = 0;
+        tables->by_high_byte[0] = 0;
+        for (uint8_t b = 0; b < 8; ++b) {
+            uint16_t half = (uint16_t)1 << b;
+            for (uint16_t v = 0; v < half; ++v) {
+                tables->by_low_byte[half + v] = tables->by_low_byte[v] ^ basis[b];
+                tables->by_high_byte[half + v] = tables->by_high_byte[v] ^ basis[8 + b];
+            }
+        }
+        return;
+    }
+
+    element_t prod[4][16]; // prod[i][v] = coef * (v * 2^(4i))
+
+    for (uint8_t i = 0; i < 4; ++i) {
+        prod[i][0] = 0;
+        for (uint8_t v = 1; v < 16; ++v)
+            prod[i][v] = prod[i][v & (v - 1)] ^ basis[4 * i + __builtin_ctz(v)];
+    }
+
+    for (uint8_t i = 0; i < 4; ++i) {
+        for (uint8_t v = 0; v < 16; ++v) {
+            tables->lo[i][v] = (uint8_t)prod[i][v];
+            tables->hi[i][v] = (uint8_t)(prod[i][v] >> 8);
+        }
+    }
+}
+
+void gf_add(void* a, const void* b, size_t symbol_size) {
+    _gf_add_scalar(a, b, symbol_size);
+}
+
+void gf_add_symbols(const GF_t* gf, void* a, const void* b, size_t symbol_size) {
+    assert(gf != NULL);
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    gf->add(a, b, symbol_size);
 }
 
 void gf_mul(GF_t* gf, void* a, element_t coef, size_t symbol_size) {
+    assert(gf != NULL);
     assert(symbol_size % sizeof(element_t) == 0);
 
     if (coef == 0) {
@@ -180,40 +571,92 @@ void gf_mul(GF_t* gf, void* a, element_t coef, size_t symbol_size) {
     if (coef == 1)
         return;
 
-    element_t* pow_table_shifted;
-    element_t* data = (element_t*)a;
-    uint16_t* log_table = gf->log_table;
+    if (gf->tier == CPU_TIER_SCALAR && symbol_size < GF_SCALAR_TABLES_MIN_SYMBOL_SIZE) {
+        _gf_mul_log(gf, a, coef, symbol_size);
+        return;
+    }
 
-    pow_table_shifted = gf->pow_table + log_table[coef];
+    gf_coef_tables_t tables;
 
-    for (const element_t* end = data + symbol_size / sizeof(element_t); data != end; ++data) {
-        element_t val = *data;
-        if (val != 0)
-            *data = pow_table_shifted[log_table[val]];
-    }
+    gf_prepare_coef(gf, &tables, coef);
+    gf->mul(a, &tables, symbol_size);
 }
 
 void gf_madd(GF_t* gf, void* a, element_t coef, const void* b, size_t symbol_size) {
+    assert(gf != NULL);
     assert(symbol_size % sizeof(element_t) == 0);
 
     if (coef == 0)
         return;
 
     if (coef == 1) {
-        gf_add(a, b, symbol_size);
+        gf->add(a, b, symbol_size);
         return;
     }
 
-    element_t* pow_table_shifted;
-    element_t* data_1 = (element_t*)a;
-    element_t* data_2 = (element_t*)b;
-    uint16_t* log_table = gf->log_table;
+    if (gf->tier == CPU_TIER_SCALAR && symbol_size < GF_SCALAR_TABLES_MIN_SYMBOL_SIZE) {
+        _gf_madd_log(gf, a, coef, b, symbol_size);
+        return;
+    }
 
-    pow_table_shifted = gf->pow_table + log_table[coef];
+    gf_coef_tables_t tables;
 
-    for (const element_t* end_1 = data_1 + symbol_size / sizeof(element_t); data_1 != end_1; ++data_1, ++data_2) {
-        element_t val_2 = *data_2;
-        if (val_2 != 0)
-            *data_1 ^= pow_table_shifted[log_table[val_2]];
+    gf_prepare_coef(gf, &tables, coef);
+    gf->madd(a, &tables, b, symbol_size);
+}
+
+void gf_madd_multi(GF_t* gf, void* a, const element_t* coefs, const void* const* b, uint16_t cnt, size_t symbol_size) {
+    assert(gf != NULL);
+    assert(coefs != NULL);
+    assert(b != NULL);
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    if (gf->tier == CPU_TIER_SCALAR && symbol_size < GF_SCALAR_TABLES_MIN_SYMBOL_SIZE) {
+        for (uint16_t i = 0; i < cnt; ++i) {
+            if (coefs[i] != 0)
+                _gf_madd_log(gf, a, coefs[i], b[i], symbol_size);
+        }
+        return;
+    }
+
+    gf_coef_tables_t tables[GF_MADD_MULTI_BATCH_SIZE];
+    const void* batch[GF_MADD_MULTI_BATCH_SIZE];
+    uint16_t batch_cnt = 0;
+
+    for (uint16_t i = 0; i < cnt; ++i) {
+        if (coefs[i] == 0)
+            continue;
+
+        gf_prepare_coef(gf, tables + batch_cnt, coefs[i]);
+        batch[batch_cnt++] = b[i];
+
+        if (batch_cnt == GF_MADD_MULTI_BATCH_SIZE) {
+            gf->madd_multi(a, tables, batch, batch_cnt, symbol_size);
+            batch_cnt = 0;
+        }
     }
+
+    if (batch_cnt != 0)
+        gf->madd_multi(a, tables, batch, batch_cnt, symbol_size);
+}
+
+void gf_madd_normal_basis(GF_t* gf, void* a, uint8_t m, uint8_t shift, const void* const* b, size_t symbol_size) {
+    assert(gf != NULL);
+    assert(b != NULL);
+    assert(shift < m);
+    assert(m <= GF_MADD_MULTI_BATCH_SIZE);
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    gf->madd_multi(a, gf->normal_bases_tables + GF_NORMAL_BASES_FIRST_TABLE_IDX_BY_M(m) + shift, b, m, symbol_size);
+}
+
+void gf_normal_basis_convolution(GF_t* gf, void* const* a, uint8_t m, const gf_coef_tables_t* scales,
+                                 const void* const* b, size_t symbol_size) {
+    assert(gf != NULL);
+    assert(a != NULL);
+    assert(b != NULL);
+    assert(m <= CC_MAX_COSET_SIZE);
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    gf->bilinear(a, gf->normal_bases_convolutions + __builtin_ctz(m), scales, b, symbol_size);
 }
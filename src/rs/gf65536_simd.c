@@ -0,0 +1,944 @@
+/**
+ * @file gf65536_simd.c
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief rs/gf65536_simd.h implementation.
+ * @date 2024-03-12
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#include <assert.h>
+
+#include <rs/gf65536_simd.h>
+
+#ifdef CPU_X86
+#include <immintrin.h>
+
+/**
+ * @brief Function attribute that enables SSSE3 instructions.
+ */
+#define GF_TARGET_SSSE3 __attribute__((target("ssse3")))
+
+/**
+ * @brief Function attribute that enables AVX2 instructions.
+ */
+#define GF_TARGET_AVX2 __attribute__((target("avx2")))
+
+/**
+ * @brief Function attribute that enables AVX-512BW instructions.
+ */
+#define GF_TARGET_AVX512BW __attribute__((target("avx512f,avx512bw")))
+
+/**
+ * @brief Compute multiplication of element and coefficient using split-nibble tables.
+ *
+ * @param tables coefficient multiplication tables.
+ * @param val element.
+ * @return multiplication result.
+ */
+static inline element_t _gf_mul_by_tables(const gf_coef_tables_t* tables, element_t val) {
+    uint8_t v0 = val & 0xf;
+    uint8_t v1 = (val >> 4) & 0xf;
+    uint8_t v2 = (val >> 8) & 0xf;
+    uint8_t v3 = val >> 12;
+
+    uint8_t lo = tables->lo[0][v0] ^ tables->lo[1][v1] ^ tables->lo[2][v2] ^ tables->lo[3][v3];
+    uint8_t hi = tables->hi[0][v0] ^ tables->hi[1][v1] ^ tables->hi[2][v2] ^ tables->hi[3][v3];
+
+    return (element_t)(lo | (hi << 8));
+}
+
+/**
+ * @brief Process symbol tail that doesn't fit into SIMD registers: "A = c * A".
+ *
+ * @param a element tail.
+ * @param tables coefficient multiplication tables.
+ * @param cnt number of GF elements in tail.
+ */
+static inline void _gf_mul_tail(element_t* a, const gf_coef_tables_t* tables, size_t cnt) {
+    for (const element_t* end = a + cnt; a != end; ++a)
+        *a = _gf_mul_by_tables(tables, *a);
+}
+
+/**
+ * @brief Process symbol tail that doesn't fit into SIMD registers: "A += c * B".
+ *
+ * @param a first element tail.
+ * @param tables coefficient multiplication tables.
+ * @param b second element tail.
+ * @param cnt number of GF elements in tail.
+ */
+static inline void _gf_madd_tail(element_t* a, const gf_coef_tables_t* tables, const element_t* b, size_t cnt) {
+    for (const element_t* end = a + cnt; a != end; ++a, ++b)
+        *a ^= _gf_mul_by_tables(tables, *b);
+}
+
+/**
+ * @brief Process symbol tail that doesn't fit into SIMD registers: "A += B".
+ *
+ * @param a first element tail.
+ * @param b second element tail.
+ * @param cnt number of GF elements in tail.
+ */
+static inline void _gf_add_tail(element_t* a, const element_t* b, size_t cnt) {
+    for (const element_t* end = a + cnt; a != end; ++a, ++b)
+        *a ^= *b;
+}
+
+/**
+ * @brief Process symbol tail that doesn't fit into SIMD registers: "A += c_0 * B_0 + ... + c_{cnt-1} * B_{cnt-1}".
+ *
+ * @param a destination element.
+ * @param tables coefficients multiplication tables.
+ * @param b source elements.
+ * @param b_cnt number of source elements.
+ * @param offset offset in bytes of the tail in source elements.
+ * @param cnt number of GF elements in tail.
+ */
+static inline void _gf_madd_multi_tail(element_t* a, const gf_coef_tables_t* tables, const void* const* b,
+                                       uint16_t b_cnt, size_t offset, size_t cnt) {
+    for (uint16_t i = 0; i < b_cnt; ++i)
+        _gf_madd_tail(a, tables + i, (const element_t*)((const uint8_t*)b[i] + offset), cnt);
+}
+
+/**
+ * @brief Process symbol tail that doesn't fit into SIMD registers: bilinear algorithm (see gf_bilinear_t).
+ *
+ * @param a destination elements.
+ * @param alg bilinear algorithm.
+ * @param scales multiplication tables of destinations scale factors or NULL.
+ * @param b source elements.
+ * @param offset offset in bytes of the tail in destination and source elements.
+ * @param cnt number of GF elements in tail.
+ */
+static inline void _gf_bilinear_tail(void* const* a, const gf_bilinear_t* alg, const gf_coef_tables_t* scales,
+                                     const void* const* b, size_t offset, size_t cnt) {
+    element_t products[GF_BILINEAR_MAX_PRODUCTS];
+
+    for (size_t i = offset / sizeof(element_t); cnt != 0; ++i, --cnt) {
+        for (uint8_t k = 0; k < alg->products_cnt; ++k) {
+            element_t val = 0;
+
+            for (uint16_t inputs = alg->inputs[k]; inputs != 0; inputs &= inputs - 1)
+                val ^= ((const element_t*)b[__builtin_ctz(inputs)])[i];
+
+            products[k] = (alg->tables[k].coef != 1) ? _gf_mul_by_tables(alg->tables + k, val) : val;
+        }
+
+        const uint8_t* term = alg->terms;
+
+        for (uint8_t j = 0; j < alg->destinations_cnt; ++j) {
+            element_t val = 0;
+
+            for (const uint8_t* end = term + alg->terms_cnt[j]; term != end; ++term)
+                val ^= products[*term];
+
+            if (scales && scales[j].coef != 1)
+                val = _gf_mul_by_tables(scales + j, val);
+
+            ((element_t*)a[j])[i] = val;
+        }
+    }
+}
+
+/**
+ * @brief Split 16 GF elements placed in 2 SSE registers into registers of low and high bytes.
+ * @details Symbol additions commute with splitting, so split elements may be added before they are joined back.
+ */
+#define GF_SSSE3_SPLIT(_x0, _x1, _lo, _hi)                                                                             \
+    do {                                                                                                               \
+        __m128i __y0 = _mm_shuffle_epi8((_x0), deinterleave);                                                          \
+        __m128i __y1 = _mm_shuffle_epi8((_x1), deinterleave);                                                          \
+        (_lo) = _mm_unpacklo_epi64(__y0, __y1);                                                                        \
+        (_hi) = _mm_unpackhi_epi64(__y0, __y1);                                                                        \
+    } while (0)
+
+/**
+ * @brief Split-nibble multiplication of 16 GF elements split by GF_SSSE3_SPLIT.
+ * @details Input registers are read before output registers are written, so they may be the same.
+ */
+#define GF_SSSE3_MUL_SPLIT(_lo, _hi, _p_lo, _p_hi)                                                                     \
+    do {                                                                                                               \
+        __m128i __n0 = _mm_and_si128((_lo), mask);                                                                     \
+        __m128i __n1 = _mm_and_si128(_mm_srli_epi64((_lo), 4), mask);                                                  \
+        __m128i __n2 = _mm_and_si128((_hi), mask);                                                                     \
+        __m128i __n3 = _mm_and_si128(_mm_srli_epi64((_hi), 4), mask);                                                  \
+        (_p_lo) = _mm_xor_si128(_mm_xor_si128(_mm_shuffle_epi8(t_lo0, __n0), _mm_shuffle_epi8(t_lo1, __n1)),           \
+                                _mm_xor_si128(_mm_shuffle_epi8(t_lo2, __n2), _mm_shuffle_epi8(t_lo3, __n3)));          \
+        (_p_hi) = _mm_xor_si128(_mm_xor_si128(_mm_shuffle_epi8(t_hi0, __n0), _mm_shuffle_epi8(t_hi1, __n1)),           \
+                                _mm_xor_si128(_mm_shuffle_epi8(t_hi2, __n2), _mm_shuffle_epi8(t_hi3, __n3)));          \
+    } while (0)
+
+/**
+ * @brief Join registers of low and high bytes back into 16 GF elements placed in 2 SSE registers.
+ */
+#define GF_SSSE3_JOIN(_lo, _hi, _r0, _r1)                                                                              \
+    do {                                                                                                               \
+        (_r0) = _mm_unpacklo_epi8((_lo), (_hi));                                                                       \
+        (_r1) = _mm_unpackhi_epi8((_lo), (_hi));                                                                       \
+    } while (0)
+
+/**
+ * @brief Split-nibble multiplication of 16 GF elements placed in 2 SSE registers.
+ * @details Low and high bytes of elements are separated, split into nibbles, multiplied by table lookups and
+ * interleaved back. Input registers are read before output registers are written, so they may be the same.
+ */
+#define GF_SSSE3_MUL(_x0, _x1, _r0, _r1)                                                                               \
+    do {                                                                                                               \
+        __m128i __lo;                                                                                                  \
+        __m128i __hi;                                                                                                  \
+        GF_SSSE3_SPLIT((_x0), (_x1), __lo, __hi);                                                                      \
+        GF_SSSE3_MUL_SPLIT(__lo, __hi, __lo, __hi);                                                                    \
+        GF_SSSE3_JOIN(__lo, __hi, (_r0), (_r1));                                                                       \
+    } while (0)
+
+/**
+ * @brief Declare and load constants used by GF_SSSE3_SPLIT and GF_SSSE3_MUL_SPLIT.
+ */
+#define GF_SSSE3_LOAD_CONSTANTS()                                                                                      \
+    const __m128i deinterleave = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);                  \
+    const __m128i mask = _mm_set1_epi8(0x0f)
+
+/**
+ * @brief Declare and load coefficient tables used by GF_SSSE3_MUL_SPLIT.
+ */
+#define GF_SSSE3_LOAD_COEF_TABLES(_tables)                                                                             \
+    const __m128i t_lo0 = _mm_loadu_si128((const __m128i*)(_tables)->lo[0]);                                           \
+    const __m128i t_lo1 = _mm_loadu_si128((const __m128i*)(_tables)->lo[1]);                                           \
+    const __m128i t_lo2 = _mm_loadu_si128((const __m128i*)(_tables)->lo[2]);                                           \
+    const __m128i t_lo3 = _mm_loadu_si128((const __m128i*)(_tables)->lo[3]);                                           \
+    const __m128i t_hi0 = _mm_loadu_si128((const __m128i*)(_tables)->hi[0]);                                           \
+    const __m128i t_hi1 = _mm_loadu_si128((const __m128i*)(_tables)->hi[1]);                                           \
+    const __m128i t_hi2 = _mm_loadu_si128((const __m128i*)(_tables)->hi[2]);                                           \
+    const __m128i t_hi3 = _mm_loadu_si128((const __m128i*)(_tables)->hi[3])
+
+/**
+ * @brief Declare and load local variables used by GF_SSSE3_MUL.
+ */
+#define GF_SSSE3_LOAD_TABLES(_tables)                                                                                  \
+    GF_SSSE3_LOAD_CONSTANTS();                                                                                         \
+    GF_SSSE3_LOAD_COEF_TABLES(_tables)
+
+GF_TARGET_SSSE3 void gf_add_ssse3(void* a, const void* b, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    uint8_t* data_1 = (uint8_t*)a;
+    const uint8_t* data_2 = (const uint8_t*)b;
+    size_t vec_size = symbol_size & ~(size_t)31;
+
+    for (const uint8_t* end_1 = data_1 + vec_size; data_1 != end_1; data_1 += 32, data_2 += 32) {
+        __m128i r0 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)data_1), _mm_loadu_si128((const __m128i*)data_2));
+        __m128i r1 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(data_1 + 16)),
+                                   _mm_loadu_si128((const __m128i*)(data_2 + 16)));
+        _mm_storeu_si128((__m128i*)data_1, r0);
+        _mm_storeu_si128((__m128i*)(data_1 + 16), r1);
+    }
+
+    _gf_add_tail((element_t*)data_1, (const element_t*)data_2, (symbol_size - vec_size) / sizeof(element_t));
+}
+
+GF_TARGET_SSSE3 void gf_mul_ssse3(void* a, const gf_coef_tables_t* tables, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    GF_SSSE3_LOAD_TABLES(tables);
+
+    uint8_t* data = (uint8_t*)a;
+    size_t vec_size = symbol_size & ~(size_t)31;
+
+    for (const uint8_t* end = data + vec_size; data != end; data += 32) {
+        __m128i x0 = _mm_loadu_si128((const __m128i*)data);
+        __m128i x1 = _mm_loadu_si128((const __m128i*)(data + 16));
+        __m128i r0;
+        __m128i r1;
+
+        GF_SSSE3_MUL(x0, x1, r0, r1);
+
+        _mm_storeu_si128((__m128i*)data, r0);
+        _mm_storeu_si128((__m128i*)(data + 16), r1);
+    }
+
+    _gf_mul_tail((element_t*)data, tables, (symbol_size - vec_size) / sizeof(element_t));
+}
+
+GF_TARGET_SSSE3 void gf_madd_ssse3(void* a, const gf_coef_tables_t* tables, const void* b, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    GF_SSSE3_LOAD_TABLES(tables);
+
+    uint8_t* data_1 = (uint8_t*)a;
+    const uint8_t* data_2 = (const uint8_t*)b;
+    size_t vec_size = symbol_size & ~(size_t)31;
+
+    for (const uint8_t* end_1 = data_1 + vec_size; data_1 != end_1; data_1 += 32, data_2 += 32) {
+        __m128i x0 = _mm_loadu_si128((const __m128i*)data_2);
+        __m128i x1 = _mm_loadu_si128((const __m128i*)(data_2 + 16));
+        __m128i r0;
+        __m128i r1;
+
+        GF_SSSE3_MUL(x0, x1, r0, r1);
+
+        r0 = _mm_xor_si128(r0, _mm_loadu_si128((const __m128i*)data_1));
+        r1 = _mm_xor_si128(r1, _mm_loadu_si128((const __m128i*)(data_1 + 16)));
+        _mm_storeu_si128((__m128i*)data_1, r0);
+        _mm_storeu_si128((__m128i*)(data_1 + 16), r1);
+    }
+
+    _gf_madd_tail((element_t*)data_1, tables, (const element_t*)data_2, (symbol_size - vec_size) / sizeof(element_t));
+}
+
+GF_TARGET_SSSE3 void gf_madd_multi_ssse3(void* a, const gf_coef_tables_t* tables, const void* const* b, uint16_t cnt,
+                                         size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+    assert(cnt <= GF_MADD_MULTI_BATCH_SIZE);
+
+    uint8_t* data_1 = (uint8_t*)a;
+    size_t vec_size = symbol_size & ~(size_t)31;
+
+    for (size_t offset = 0; offset != vec_size; offset += 32) {
+        __m128i acc0 = _mm_loadu_si128((const __m128i*)(data_1 + offset));
+        __m128i acc1 = _mm_loadu_si128((const __m128i*)(data_1 + offset + 16));
+
+        for (uint16_t i = 0; i < cnt; ++i) {
+            const uint8_t* data_2 = (const uint8_t*)b[i] + offset;
+            __m128i x0 = _mm_loadu_si128((const __m128i*)data_2);
+            __m128i x1 = _mm_loadu_si128((const __m128i*)(data_2 + 16));
+
+            if (tables[i].coef != 1) {
+                GF_SSSE3_LOAD_TABLES(tables + i);
+                GF_SSSE3_MUL(x0, x1, x0, x1);
+            }
+
+            acc0 = _mm_xor_si128(acc0, x0);
+            acc1 = _mm_xor_si128(acc1, x1);
+        }
+
+        _mm_storeu_si128((__m128i*)(data_1 + offset), acc0);
+        _mm_storeu_si128((__m128i*)(data_1 + offset + 16), acc1);
+    }
+
+    _gf_madd_multi_tail((element_t*)(data_1 + vec_size), tables, b, cnt, vec_size,
+                        (symbol_size - vec_size) / sizeof(element_t));
+}
+
+GF_TARGET_SSSE3 void gf_bilinear_ssse3(void* const* a, const gf_bilinear_t* alg, const gf_coef_tables_t* scales,
+                                       const void* const* b, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+    assert(alg->sources_cnt <= GF_BILINEAR_MAX_SYMBOLS);
+    assert(alg->destinations_cnt <= GF_BILINEAR_MAX_SYMBOLS);
+
+    GF_SSSE3_LOAD_CONSTANTS();
+
+    __m128i sources[GF_BILINEAR_MAX_SYMBOLS][2];   // split sources
+    __m128i products[GF_BILINEAR_MAX_PRODUCTS][2]; // split products
+    size_t vec_size = symbol_size & ~(size_t)31;
+
+    for (size_t offset = 0; offset != vec_size; offset += 32) {
+        for (uint8_t t = 0; t < alg->sources_cnt; ++t) {
+            const uint8_t* data = (const uint8_t*)b[t] + offset;
+
+            __m128i x0 = _mm_loadu_si128((const __m128i*)data);
+            __m128i x1 = _mm_loadu_si128((const __m128i*)(data + 16));
+
+            GF_SSSE3_SPLIT(x0, x1, sources[t][0], sources[t][1]);
+        }
+
+        for (uint8_t k = 0; k < alg->products_cnt; ++k) {
+            uint16_t inputs = alg->inputs[k];
+            uint8_t t = __builtin_ctz(inputs);
+            __m128i lo = sources[t][0];
+            __m128i hi = sources[t][1];
+
+            for (inputs &= inputs - 1; inputs != 0; inputs &= inputs - 1) {
+                t = __builtin_ctz(inputs);
+                lo = _mm_xor_si128(lo, sources[t][0]);
+                hi = _mm_xor_si128(hi, sources[t][1]);
+            }
+
+            if (alg->tables[k].coef != 1) {
+                GF_SSSE3_LOAD_COEF_TABLES(alg->tables + k);
+                GF_SSSE3_MUL_SPLIT(lo, hi, lo, hi);
+            }
+
+            products[k][0] = lo;
+            products[k][1] = hi;
+        }
+
+        const uint8_t* term = alg->terms;
+
+        for (uint8_t j = 0; j < alg->destinations_cnt; ++j) {
+            uint8_t* data = (uint8_t*)a[j] + offset;
+            __m128i lo = _mm_setzero_si128();
+            __m128i hi = _mm_setzero_si128();
+            __m128i r0;
+            __m128i r1;
+
+            for (const uint8_t* end = term + alg->terms_cnt[j]; term != end; ++term) {
+                lo = _mm_xor_si128(lo, products[*term][0]);
+                hi = _mm_xor_si128(hi, products[*term][1]);
+            }
+
+            if (scales && scales[j].coef != 1) {
+                GF_SSSE3_LOAD_COEF_TABLES(scales + j);
+                GF_SSSE3_MUL_SPLIT(lo, hi, lo, hi);
+            }
+
+            GF_SSSE3_JOIN(lo, hi, r0, r1);
+
+            _mm_storeu_si128((__m128i*)data, r0);
+            _mm_storeu_si128((__m128i*)(data + 16), r1);
+        }
+    }
+
+    _gf_bilinear_tail(a, alg, scales, b, vec_size, (symbol_size - vec_size) / sizeof(element_t));
+}
+
+/**
+ * @brief Split 32 GF elements placed in 2 AVX2 registers into registers of low and high bytes.
+ * @details Same as GF_SSSE3_SPLIT, all shuffles work inside 128-bit lanes.
+ */
+#define GF_AVX2_SPLIT(_x0, _x1, _lo, _hi)                                                                              \
+    do {                                                                                                               \
+        __m256i __y0 = _mm256_shuffle_epi8((_x0), deinterleave);                                                       \
+        __m256i __y1 = _mm256_shuffle_epi8((_x1), deinterleave);                                                       \
+        (_lo) = _mm256_unpacklo_epi64(__y0, __y1);                                                                     \
+        (_hi) = _mm256_unpackhi_epi64(__y0, __y1);                                                                     \
+    } while (0)
+
+/**
+ * @brief Split-nibble multiplication of 32 GF elements split by GF_AVX2_SPLIT.
+ * @details Input registers are read before output registers are written, so they may be the same.
+ */
+#define GF_AVX2_MUL_SPLIT(_lo, _hi, _p_lo, _p_hi)                                                                      \
+    do {                                                                                                               \
+        __m256i __n0 = _mm256_and_si256((_lo), mask);                                                                  \
+        __m256i __n1 = _mm256_and_si256(_mm256_srli_epi64((_lo), 4), mask);                                            \
+        __m256i __n2 = _mm256_and_si256((_hi), mask);                                                                  \
+        __m256i __n3 = _mm256_and_si256(_mm256_srli_epi64((_hi), 4), mask);                                            \
+        (_p_lo) =                                                                                                      \
+            _mm256_xor_si256(_mm256_xor_si256(_mm256_shuffle_epi8(t_lo0, __n0), _mm256_shuffle_epi8(t_lo1, __n1)),     \
+                             _mm256_xor_si256(_mm256_shuffle_epi8(t_lo2, __n2), _mm256_shuffle_epi8(t_lo3, __n3)));    \
+        (_p_hi) =                                                                                                      \
+            _mm256_xor_si256(_mm256_xor_si256(_mm256_shuffle_epi8(t_hi0, __n0), _mm256_shuffle_epi8(t_hi1, __n1)),     \
+                             _mm256_xor_si256(_mm256_shuffle_epi8(t_hi2, __n2), _mm256_shuffle_epi8(t_hi3, __n3)));    \
+    } while (0)
+
+/**
+ * @brief Join registers of low and high bytes back into 32 GF elements placed in 2 AVX2 registers.
+ */
+#define GF_AVX2_JOIN(_lo, _hi, _r0, _r1)                                                                               \
+    do {                                                                                                               \
+        (_r0) = _mm256_unpacklo_epi8((_lo), (_hi));                                                                    \
+        (_r1) = _mm256_unpackhi_epi8((_lo), (_hi));                                                                    \
+    } while (0)
+
+/**
+ * @brief Split-nibble multiplication of 32 GF elements placed in 2 AVX2 registers.
+ * @details All shuffles work inside 128-bit lanes, so lane-crossing permutations are not needed: the output
+ * registers have the same element layout as the input ones.
+ */
+#define GF_AVX2_MUL(_x0, _x1, _r0, _r1)                                                                                \
+    do {                                                                                                               \
+        __m256i __lo;                                                                                                  \
+        __m256i __hi;                                                                                                  \
+        GF_AVX2_SPLIT((_x0), (_x1), __lo, __hi);                                                                       \
+        GF_AVX2_MUL_SPLIT(__lo, __hi, __lo, __hi);                                                                     \
+        GF_AVX2_JOIN(__lo, __hi, (_r0), (_r1));                                                                        \
+    } while (0)
+
+/**
+ * @brief Load 16-byte table to both lanes of AVX2 register.
+ */
+#define GF_AVX2_BROADCAST(_table) _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(_table)))
+
+/**
+ * @brief Declare and load constants used by GF_AVX2_SPLIT and GF_AVX2_MUL_SPLIT.
+ */
+#define GF_AVX2_LOAD_CONSTANTS()                                                                                       \
+    const __m256i deinterleave = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15, 0, 2, 4, 6, 8, \
+                                                  10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);                              \
+    const __m256i mask = _mm256_set1_epi8(0x0f)
+
+/**
+ * @brief Declare and load coefficient tables used by GF_AVX2_MUL_SPLIT.
+ */
+#define GF_AVX2_LOAD_COEF_TABLES(_tables)                                                                              \
+    const __m256i t_lo0 = GF_AVX2_BROADCAST((_tables)->lo[0]);                                                         \
+    const __m256i t_lo1 = GF_AVX2_BROADCAST((_tables)->lo[1]);                                                         \
+    const __m256i t_lo2 = GF_AVX2_BROADCAST((_tables)->lo[2]);                                                         \
+    const __m256i t_lo3 = GF_AVX2_BROADCAST((_tables)->lo[3]);                                                         \
+    const __m256i t_hi0 = GF_AVX2_BROADCAST((_tables)->hi[0]);                                                         \
+    const __m256i t_hi1 = GF_AVX2_BROADCAST((_tables)->hi[1]);                                                         \
+    const __m256i t_hi2 = GF_AVX2_BROADCAST((_tables)->hi[2]);                                                         \
+    const __m256i t_hi3 = GF_AVX2_BROADCAST((_tables)->hi[3])
+
+/**
+ * @brief Declare and load local variables used by GF_AVX2_MUL.
+ */
+#define GF_AVX2_LOAD_TABLES(_tables)                                                                                   \
+    GF_AVX2_LOAD_CONSTANTS();                                                                                          \
+    GF_AVX2_LOAD_COEF_TABLES(_tables)
+
+GF_TARGET_AVX2 void gf_add_avx2(void* a, const void* b, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    uint8_t* data_1 = (uint8_t*)a;
+    const uint8_t* data_2 = (const uint8_t*)b;
+    size_t vec_size = symbol_size & ~(size_t)63;
+
+    for (const uint8_t* end_1 = data_1 + vec_size; data_1 != end_1; data_1 += 64, data_2 += 64) {
+        __m256i r0 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)data_1),
+                                      _mm256_loadu_si256((const __m256i*)data_2));
+        __m256i r1 = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)(data_1 + 32)),
+                                      _mm256_loadu_si256((const __m256i*)(data_2 + 32)));
+        _mm256_storeu_si256((__m256i*)data_1, r0);
+        _mm256_storeu_si256((__m256i*)(data_1 + 32), r1);
+    }
+
+    _gf_add_tail((element_t*)data_1, (const element_t*)data_2, (symbol_size - vec_size) / sizeof(element_t));
+}
+
+GF_TARGET_AVX2 void gf_mul_avx2(void* a, const gf_coef_tables_t* tables, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    GF_AVX2_LOAD_TABLES(tables);
+
+    uint8_t* data = (uint8_t*)a;
+    size_t vec_size = symbol_size & ~(size_t)63;
+
+    for (const uint8_t* end = data + vec_size; data != end; data += 64) {
+        __m256i x0 = _mm256_loadu_si256((const __m256i*)data);
+        __m256i x1 = _mm256_loadu_si256((const __m256i*)(data + 32));
+        __m256i r0;
+        __m256i r1;
+
+        GF_AVX2_MUL(x0, x1, r0, r1);
+
+        _mm256_storeu_si256((__m256i*)data, r0);
+        _mm256_storeu_si256((__m256i*)(data + 32), r1);
+    }
+
+    _gf_mul_tail((element_t*)data, tables, (symbol_size - vec_size) / sizeof(element_t));
+}
+
+GF_TARGET_AVX2 void gf_madd_avx2(void* a, const gf_coef_tables_t* tables, const void* b, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    GF_AVX2_LOAD_TABLES(tables);
+
+    uint8_t* data_1 = (uint8_t*)a;
+    const uint8_t* data_2 = (const uint8_t*)b;
+    size_t vec_size = symbol_size & ~(size_t)63;
+
+    for (const uint8_t* end_1 = data_1 + vec_size; data_1 != end_1; data_1 += 64, data_2 += 64) {
+        __m256i x0 = _mm256_loadu_si256((const __m256i*)data_2);
+        __m256i x1 = _mm256_loadu_si256((const __m256i*)(data_2 + 32));
+        __m256i r0;
+        __m256i r1;
+
+        GF_AVX2_MUL(x0, x1, r0, r1);
+
+        r0 = _mm256_xor_si256(r0, _mm256_loadu_si256((const __m256i*)data_1));
+        r1 = _mm256_xor_si256(r1, _mm256_loadu_si256((const __m256i*)(data_1 + 32)));
+        _mm256_storeu_si256((__m256i*)data_1, r0);
+        _mm256_storeu_si256((__m256i*)(data_1 + 32), r1);
+    }
+
+    _gf_madd_tail((element_t*)data_1, tables, (const element_t*)data_2, (symbol_size - vec_size) / sizeof(element_t));
+}
+
+GF_TARGET_AVX2 void gf_madd_multi_avx2(void* a, const gf_coef_tables_t* tables, const void* const* b, uint16_t cnt,
+                                       size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+    assert(cnt <= GF_MADD_MULTI_BATCH_SIZE);
+
+    uint8_t* data_1 = (uint8_t*)a;
+    size_t vec_size = symbol_size & ~(size_t)63;
+
+    for (size_t offset = 0; offset != vec_size; offset += 64) {
+        __m256i acc0 = _mm256_loadu_si256((const __m256i*)(data_1 + offset));
+        __m256i acc1 = _mm256_loadu_si256((const __m256i*)(data_1 + offset + 32));
+
+        for (uint16_t i = 0; i < cnt; ++i) {
+            const uint8_t* data_2 = (const uint8_t*)b[i] + offset;
+            __m256i x0 = _mm256_loadu_si256((const __m256i*)data_2);
+            __m256i x1 = _mm256_loadu_si256((const __m256i*)(data_2 + 32));
+
+            if (tables[i].coef != 1) {
+                GF_AVX2_LOAD_TABLES(tables + i);
+                GF_AVX2_MUL(x0, x1, x0, x1);
+            }
+
+            acc0 = _mm256_xor_si256(acc0, x0);
+            acc1 = _mm256_xor_si256(acc1, x1);
+        }
+
+        _mm256_storeu_si256((__m256i*)(data_1 + offset), acc0);
+        _mm256_storeu_si256((__m256i*)(data_1 + offset + 32), acc1);
+    }
+
+    _gf_madd_multi_tail((element_t*)(data_1 + vec_size), tables, b, cnt, vec_size,
+                        (symbol_size - vec_size) / sizeof(element_t));
+}
+
+GF_TARGET_AVX2 void gf_bilinear_avx2(void* const* a, const gf_bilinear_t* alg, const gf_coef_tables_t* scales,
+                                     const void* const* b, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+    assert(alg->sources_cnt <= GF_BILINEAR_MAX_SYMBOLS);
+    assert(alg->destinations_cnt <= GF_BILINEAR_MAX_SYMBOLS);
+
+    GF_AVX2_LOAD_CONSTANTS();
+
+    __m256i sources[GF_BILINEAR_MAX_SYMBOLS][2];   // split sources
+    __m256i products[GF_BILINEAR_MAX_PRODUCTS][2]; // split products
+    size_t vec_size = symbol_size & ~(size_t)63;
+
+    for (size_t offset = 0; offset != vec_size; offset += 64) {
+        for (uint8_t t = 0; t < alg->sources_cnt; ++t) {
+            const uint8_t* data = (const uint8_t*)b[t] + offset;
+
+            __m256i x0 = _mm256_loadu_si256((const __m256i*)data);
+            __m256i x1 = _mm256_loadu_si256((const __m256i*)(data + 32));
+
+            GF_AVX2_SPLIT(x0, x1, sources[t][0], sources[t][1]);
+        }
+
+        for (uint8_t k = 0; k < alg->products_cnt; ++k) {
+            uint16_t inputs = alg->inputs[k];
+            uint8_t t = __builtin_ctz(inputs);
+            __m256i lo = sources[t][0];
+            __m256i hi = sources[t][1];
+
+            for (inputs &= inputs - 1; inputs != 0; inputs &= inputs - 1) {
+                t = __builtin_ctz(inputs);
+                lo = _mm256_xor_si256(lo, sources[t][0]);
+                hi = _mm256_xor_si256(hi, sources[t][1]);
+            }
+
+            if (alg->tables[k].coef != 1) {
+                GF_AVX2_LOAD_COEF_TABLES(alg->tables + k);
+                GF_AVX2_MUL_SPLIT(lo, hi, lo, hi);
+            }
+
+            products[k][0] = lo;
+            products[k][1] = hi;
+        }
+
+        const uint8_t* term = alg->terms;
+
+        for (uint8_t j = 0; j < alg->destinations_cnt; ++j) {
+            uint8_t* data = (uint8_t*)a[j] + offset;
+            __m256i lo = _mm256_setzero_si256();
+            __m256i hi = _mm256_setzero_si256();
+            __m256i r0;
+            __m256i r1;
+
+            for (const uint8_t* end = term + alg->terms_cnt[j]; term != end; ++term) {
+                lo = _mm256_xor_si256(lo, products[*term][0]);
+                hi = _mm256_xor_si256(hi, products[*term][1]);
+            }
+
+            if (scales && scales[j].coef != 1) {
+                GF_AVX2_LOAD_COEF_TABLES(scales + j);
+                GF_AVX2_MUL_SPLIT(lo, hi, lo, hi);
+            }
+
+            GF_AVX2_JOIN(lo, hi, r0, r1);
+
+            _mm256_storeu_si256((__m256i*)data, r0);
+            _mm256_storeu_si256((__m256i*)(data + 32), r1);
+        }
+    }
+
+    if (vec_size == symbol_size)
+        return;
+
+    void* a_tail[GF_BILINEAR_MAX_SYMBOLS];
+    const void* b_tail[GF_BILINEAR_MAX_SYMBOLS];
+
+    for (uint8_t j = 0; j < alg->destinations_cnt; ++j)
+        a_tail[j] = (void*)((uint8_t*)a[j] + vec_size);
+
+    for (uint8_t t = 0; t < alg->sources_cnt; ++t)
+        b_tail[t] = (const void*)((const uint8_t*)b[t] + vec_size);
+
+    gf_bilinear_ssse3(a_tail, alg, scales, b_tail, symbol_size - vec_size);
+}
+
+/**
+ * @brief Split 64 GF elements placed in 2 AVX-512 registers into registers of low and high bytes.
+ * @details Same as GF_SSSE3_SPLIT, all shuffles work inside 128-bit lanes.
+ */
+#define GF_AVX512BW_SPLIT(_x0, _x1, _lo, _hi)                                                                          \
+    do {                                                                                                               \
+        __m512i __y0 = _mm512_shuffle_epi8((_x0), deinterleave);                                                       \
+        __m512i __y1 = _mm512_shuffle_epi8((_x1), deinterleave);                                                       \
+        (_lo) = _mm512_unpacklo_epi64(__y0, __y1);                                                                     \
+        (_hi) = _mm512_unpackhi_epi64(__y0, __y1);                                                                     \
+    } while (0)
+
+/**
+ * @brief Split-nibble multiplication of 64 GF elements split by GF_AVX512BW_SPLIT.
+ * @details Input registers are read before output registers are written, so they may be the same.
+ */
+#define GF_AVX512BW_MUL_SPLIT(_lo, _hi, _p_lo, _p_hi)                                                                  \
+    do {                                                                                                               \
+        __m512i __n0 = _mm512_and_si512((_lo), mask);                                                                  \
+        __m512i __n1 = _mm512_and_si512(_mm512_srli_epi64((_lo), 4), mask);                                            \
+        __m512i __n2 = _mm512_and_si512((_hi), mask);                                                                  \
+        __m512i __n3 = _mm512_and_si512(_mm512_srli_epi64((_hi), 4), mask);                                            \
+        (_p_lo) =                                                                                                      \
+            _mm512_xor_si512(_mm512_xor_si512(_mm512_shuffle_epi8(t_lo0, __n0), _mm512_shuffle_epi8(t_lo1, __n1)),     \
+                             _mm512_xor_si512(_mm512_shuffle_epi8(t_lo2, __n2), _mm512_shuffle_epi8(t_lo3, __n3)));    \
+        (_p_hi) =                                                                                                      \
+            _mm512_xor_si512(_mm512_xor_si512(_mm512_shuffle_epi8(t_hi0, __n0), _mm512_shuffle_epi8(t_hi1, __n1)),     \
+                             _mm512_xor_si512(_mm512_shuffle_epi8(t_hi2, __n2), _mm512_shuffle_epi8(t_hi3, __n3)));    \
+    } while (0)
+
+/**
+ * @brief Join registers of low and high bytes back into 64 GF elements placed in 2 AVX-512 registers.
+ */
+#define GF_AVX512BW_JOIN(_lo, _hi, _r0, _r1)                                                                           \
+    do {                                                                                                               \
+        (_r0) = _mm512_unpacklo_epi8((_lo), (_hi));                                                                    \
+        (_r1) = _mm512_unpackhi_epi8((_lo), (_hi));                                                                    \
+    } while (0)
+
+/**
+ * @brief Split-nibble multiplication of 64 GF elements placed in 2 AVX-512 registers.
+ * @details Same as GF_AVX2_MUL, all shuffles work inside 128-bit lanes.
+ */
+#define GF_AVX512BW_MUL(_x0, _x1, _r0, _r1)                                                                            \
+    do {                                                                                                               \
+        __m512i __lo;                                                                                                  \
+        __m512i __hi;                                                                                                  \
+        GF_AVX512BW_SPLIT((_x0), (_x1), __lo, __hi);                                                                   \
+        GF_AVX512BW_MUL_SPLIT(__lo, __hi, __lo, __hi);                                                                 \
+        GF_AVX512BW_JOIN(__lo, __hi, (_r0), (_r1));                                                                    \
+    } while (0)
+
+/**
+ * @brief Load 16-byte table to all lanes of AVX-512 register.
+ */
+#define GF_AVX512BW_BROADCAST(_table) _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)(_table)))
+
+/**
+ * @brief Declare and load constants used by GF_AVX512BW_SPLIT and GF_AVX512BW_MUL_SPLIT.
+ */
+#define GF_AVX512BW_LOAD_CONSTANTS()                                                                                   \
+    const __m512i deinterleave =                                                                                       \
+        GF_AVX512BW_BROADCAST(((const uint8_t[16]){0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15}));            \
+    const __m512i mask = _mm512_set1_epi8(0x0f)
+
+/**
+ * @brief Declare and load coefficient tables used by GF_AVX512BW_MUL_SPLIT.
+ */
+#define GF_AVX512BW_LOAD_COEF_TABLES(_tables)                                                                          \
+    const __m512i t_lo0 = GF_AVX512BW_BROADCAST((_tables)->lo[0]);                                                     \
+    const __m512i t_lo1 = GF_AVX512BW_BROADCAST((_tables)->lo[1]);                                                     \
+    const __m512i t_lo2 = GF_AVX512BW_BROADCAST((_tables)->lo[2]);                                                     \
+    const __m512i t_lo3 = GF_AVX512BW_BROADCAST((_tables)->lo[3]);                                                     \
+    const __m512i t_hi0 = GF_AVX512BW_BROADCAST((_tables)->hi[0]);                                                     \
+    const __m512i t_hi1 = GF_AVX512BW_BROADCAST((_tables)->hi[1]);                                                     \
+    const __m512i t_hi2 = GF_AVX512BW_BROADCAST((_tables)->hi[2]);                                                     \
+    const __m512i t_hi3 = GF_AVX512BW_BROADCAST((_tables)->hi[3])
+
+/**
+ * @brief Declare and load local variables used by GF_AVX512BW_MUL.
+ */
+#define GF_AVX512BW_LOAD_TABLES(_tables)                                                                               \
+    GF_AVX512BW_LOAD_CONSTANTS();                                                                                      \
+    GF_AVX512BW_LOAD_COEF_TABLES(_tables)
+
+GF_TARGET_AVX512BW void gf_add_avx512bw(void* a, const void* b, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    uint8_t* data_1 = (uint8_t*)a;
+    const uint8_t* data_2 = (const uint8_t*)b;
+    size_t vec_size = symbol_size & ~(size_t)127;
+
+    for (const uint8_t* end_1 = data_1 + vec_size; data_1 != end_1; data_1 += 128, data_2 += 128) {
+        __m512i r0 = _mm512_xor_si512(_mm512_loadu_si512((const void*)data_1), _mm512_loadu_si512((const void*)data_2));
+        __m512i r1 = _mm512_xor_si512(_mm512_loadu_si512((const void*)(data_1 + 64)),
+                                      _mm512_loadu_si512((const void*)(data_2 + 64)));
+        _mm512_storeu_si512((void*)data_1, r0);
+        _mm512_storeu_si512((void*)(data_1 + 64), r1);
+    }
+
+    gf_add_avx2((void*)data_1, (const void*)data_2, symbol_size - vec_size);
+}
+
+GF_TARGET_AVX512BW void gf_mul_avx512bw(void* a, const gf_coef_tables_t* tables, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    GF_AVX512BW_LOAD_TABLES(tables);
+
+    uint8_t* data = (uint8_t*)a;
+    size_t vec_size = symbol_size & ~(size_t)127;
+
+    for (const uint8_t* end = data + vec_size; data != end; data += 128) {
+        __m512i x0 = _mm512_loadu_si512((const void*)data);
+        __m512i x1 = _mm512_loadu_si512((const void*)(data + 64));
+        __m512i r0;
+        __m512i r1;
+
+        GF_AVX512BW_MUL(x0, x1, r0, r1);
+
+        _mm512_storeu_si512((void*)data, r0);
+        _mm512_storeu_si512((void*)(data + 64), r1);
+    }
+
+    gf_mul_avx2((void*)data, tables, symbol_size - vec_size);
+}
+
+GF_TARGET_AVX512BW void gf_madd_avx512bw(void* a, const gf_coef_tables_t* tables, const void* b, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+
+    GF_AVX512BW_LOAD_TABLES(tables);
+
+    uint8_t* data_1 = (uint8_t*)a;
+    const uint8_t* data_2 = (const uint8_t*)b;
+    size_t vec_size = symbol_size & ~(size_t)127;
+
+    for (const uint8_t* end_1 = data_1 + vec_size; data_1 != end_1; data_1 += 128, data_2 += 128) {
+        __m512i x0 = _mm512_loadu_si512((const void*)data_2);
+        __m512i x1 = _mm512_loadu_si512((const void*)(data_2 + 64));
+        __m512i r0;
+        __m512i r1;
+
+        GF_AVX512BW_MUL(x0, x1, r0, r1);
+
+        r0 = _mm512_xor_si512(r0, _mm512_loadu_si512((const void*)data_1));
+        r1 = _mm512_xor_si512(r1, _mm512_loadu_si512((const void*)(data_1 + 64)));
+        _mm512_storeu_si512((void*)data_1, r0);
+        _mm512_storeu_si512((void*)(data_1 + 64), r1);
+    }
+
+    gf_madd_avx2((void*)data_1, tables, (const void*)data_2, symbol_size - vec_size);
+}
+
+GF_TARGET_AVX512BW void gf_madd_multi_avx512bw(void* a, const gf_coef_tables_t* tables, const void* const* b,
+                                               uint16_t cnt, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+    assert(cnt <= GF_MADD_MULTI_BATCH_SIZE);
+
+    uint8_t* data_1 = (uint8_t*)a;
+    size_t vec_size = symbol_size & ~(size_t)127;
+
+    for (size_t offset = 0; offset != vec_size; offset += 128) {
+        __m512i acc0 = _mm512_loadu_si512((const void*)(data_1 + offset));
+        __m512i acc1 = _mm512_loadu_si512((const void*)(data_1 + offset + 64));
+
+        for (uint16_t i = 0; i < cnt; ++i) {
+            const uint8_t* data_2 = (const uint8_t*)b[i] + offset;
+            __m512i x0 = _mm512_loadu_si512((const void*)data_2);
+            __m512i x1 = _mm512_loadu_si512((const void*)(data_2 + 64));
+
+            if (tables[i].coef != 1) {
+                GF_AVX512BW_LOAD_TABLES(tables + i);
+                GF_AVX512BW_MUL(x0, x1, x0, x1);
+            }
+
+            acc0 = _mm512_xor_si512(acc0, x0);
+            acc1 = _mm512_xor_si512(acc1, x1);
+        }
+
+        _mm512_storeu_si512((void*)(data_1 + offset), acc0);
+        _mm512_storeu_si512((void*)(data_1 + offset + 64), acc1);
+    }
+
+    if (vec_size == symbol_size)
+        return;
+
+    const void* b_tail[GF_MADD_MULTI_BATCH_SIZE];
+
+    for (uint16_t i = 0; i < cnt; ++i)
+        b_tail[i] = (const void*)((const uint8_t*)b[i] + vec_size);
+
+    gf_madd_multi_avx2((void*)(data_1 + vec_size), tables, b_tail, cnt, symbol_size - vec_size);
+}
+
+GF_TARGET_AVX512BW void gf_bilinear_avx512bw(void* const* a, const gf_bilinear_t* alg, const gf_coef_tables_t* scales,
+                                             const void* const* b, size_t symbol_size) {
+    assert(symbol_size % sizeof(element_t) == 0);
+    assert(alg->sources_cnt <= GF_BILINEAR_MAX_SYMBOLS);
+    assert(alg->destinations_cnt <= GF_BILINEAR_MAX_SYMBOLS);
+
+    GF_AVX512BW_LOAD_CONSTANTS();
+
+    __m512i sources[GF_BILINEAR_MAX_SYMBOLS][2];   // split sources
+    __m512i products[GF_BILINEAR_MAX_PRODUCTS][2]; // split products
+    size_t vec_size = symbol_size & ~(size_t)127;
+
+    for (size_t offset = 0; offset != vec_size; offset += 128) {
+        for (uint8_t t = 0; t < alg->sources_cnt; ++t) {
+            const uint8_t* data = (const uint8_t*)b[t] + offset;
+
+            __m512i x0 = _mm512_loadu_si512((const void*)data);
+            __m512i x1 = _mm512_loadu_si512((const void*)(data + 64));
+
+            GF_AVX512BW_SPLIT(x0, x1, sources[t][0], sources[t][1]);
+        }
+
+        for (uint8_t k = 0; k < alg->products_cnt; ++k) {
+            uint16_t inputs = alg->inputs[k];
+            uint8_t t = __builtin_ctz(inputs);
+            __m512i lo = sources[t][0];
+            __m512i hi = sources[t][1];
+
+            for (inputs &= inputs - 1; inputs != 0; inputs &= inputs - 1) {
+                t = __builtin_ctz(inputs);
+                lo = _mm512_xor_si512(lo, sources[t][0]);
+                hi = _mm512_xor_si512(hi, sources[t][1]);
+            }
+
+            if (alg->tables[k].coef != 1) {
+                GF_AVX512BW_LOAD_COEF_TABLES(alg->tables + k);
+                GF_AVX512BW_MUL_SPLIT(lo, hi, lo, hi);
+            }
+
+            products[k][0] = lo;
+            products[k][1] = hi;
+        }
+
+        const uint8_t* term = alg->terms;
+
+        for (uint8_t j = 0; j < alg->destinations_cnt; ++j) {
+            uint8_t* data = (uint8_t*)a[j] + offset;
+            __m512i lo = _mm512_setzero_si512();
+            __m512i hi = _mm512_setzero_si512();
+            __m512i r0;
+            __m512i r1;
+
+            for (const uint8_t* end = term + alg->terms_cnt[j]; term != end; ++term) {
+                lo = _mm512_xor_si512(lo, products[*term][0]);
+                hi = _mm512_xor_si512(hi, products[*term][1]);
+            }
+
+            if (scales && scales[j].coef != 1) {
+                GF_AVX512BW_LOAD_COEF_TABLES(scales + j);
+                GF_AVX512BW_MUL_SPLIT(lo, hi, lo, hi);
+            }
+
+            GF_AVX512BW_JOIN(lo, hi, r0, r1);
+
+            _mm512_storeu_si512((void*)data, r0);
+            _mm512_storeu_si512((void*)(data + 64), r1);
+        }
+    }
+
+    if (vec_size == symbol_size)
+        return;
+
+    void* a_tail[GF_BILINEAR_MAX_SYMBOLS];
+    const void* b_tail[GF_BILINEAR_MAX_SYMBOLS];
+
+    for (uint8_t j = 0; j < alg->destinations_cnt; ++j)
+        a_tail[j] = (void*)((uint8_t*)a[j] + vec_size);
+
+    for (uint8_t t = 0; t < alg->sources_cnt; ++t)
+        b_tail[t] = (const void*)((const uint8_t*)b[t] + vec_size);
+
+    gf_bilinear_avx2(a_tail, alg, scales, b_tail, symbol_size - vec_size);
+}
+
+#endif
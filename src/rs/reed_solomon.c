@@ -11,8 +11,10 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <rs/additive_fft.h>
 #include <rs/fft.h>
 #include <rs/reed_solomon.h>
+#include <util/util.h>
 
 RS_t* rs_create() {
     RS_t* rs;
@@ -35,17 +37,90 @@ RS_t* rs_create() {
         return NULL;
     }
 
+    rs->workspace = workspace_create();
+    if (!rs->workspace) {
+        cc_destroy(rs->cc);
+        gf_destroy(rs->gf);
+        free(rs);
+        return NULL;
+    }
+    rs->owns_workspace = true;
+
+    const char* threads_env = getenv(RS_THREADS_ENV);
+    int threads_cnt = threads_env ? atoi(threads_env) : 1;
+
+    if (threads_cnt > 1 && rs_set_threads_cnt(rs, (uint16_t)MIN(threads_cnt, RS_MAX_THREADS_CNT))) {
+        workspace_destroy(rs->workspace);
+        cc_destroy(rs->cc);
+        gf_destroy(rs->gf);
+        free(rs);
+        return NULL;
+    }
+
     return rs;
 }
 
 void rs_destroy(RS_t* rs) {
     assert(rs != NULL);
 
+    if (rs->plan)
+        rs_plan_destroy(rs->plan);
+    if (rs->pool)
+        pool_destroy(rs->pool);
+    if (rs->owns_workspace)
+        workspace_destroy(rs->workspace);
     cc_destroy(rs->cc);
     gf_destroy(rs->gf);
     free(rs);
 }
 
+int rs_set_threads_cnt(RS_t* rs, uint16_t threads_cnt) {
+    assert(rs != NULL);
+    assert(threads_cnt > 0 && threads_cnt <= RS_MAX_THREADS_CNT);
+
+    pool_t* pool = NULL;
+
+    if (threads_cnt > 1) {
+        pool = pool_create(threads_cnt);
+        if (!pool)
+            return 1;
+    }
+
+    if (rs->pool)
+        pool_destroy(rs->pool);
+    rs->pool = pool;
+
+    return 0;
+}
+
+void rs_set_workspace(RS_t* rs, workspace_t* ws) {
+    assert(rs != NULL);
+    assert(ws != NULL);
+
+    if (rs->owns_workspace)
+        workspace_destroy(rs->workspace);
+    rs->workspace = ws;
+    rs->owns_workspace = false;
+}
+
+void rs_set_engine(RS_t* rs, rs_engine_t engine) {
+    assert(rs != NULL);
+
+    rs->engine = engine;
+}
+
+void rs_set_cosets_selection(RS_t* rs, cc_selection_t selection) {
+    assert(rs != NULL);
+
+    cc_set_selection(rs->cc, selection);
+
+    // symbol positions of the kept plan depend on the strategy
+    if (rs->plan) {
+        rs_plan_destroy(rs->plan);
+        rs->plan = NULL;
+    }
+}
+
 /**
  * @brief Compute syndrome polynomial.
  *
@@ -64,7 +139,7 @@ static int _rs_get_syndrome_poly(RS_t* rs, const symbol_seq_t* seq, const uint16
 
     int err;
 
-    err = fft_transform_cycl(rs->gf, seq, positions, syndrome_poly);
+    err = fft_transform_cycl_parallel(rs->gf, rs->pool, rs->workspace, seq, positions, syndrome_poly);
     if (err)
         return err;
 
@@ -73,32 +148,159 @@ static int _rs_get_syndrome_poly(RS_t* rs, const symbol_seq_t* seq, const uint16
 
 /**
  * @brief Compute locator polynomial.
+ * @details Locator polynomial is multiplied by \f$(1 + \alpha^{pos} x)\f$ for every position: coefficients of
+ * shifted polynomial are scaled by symbol arithmetic kernels as an array of elements.
  *
  * @param rs context object.
  * @param positions positions.
  * @param positions_cnt number of positions.
  * @param locator_poly where to place locator polynomial coefficients.
  * @param locator_max_len max number of locator polynomial coefficients.
+ * @param buffer temporary buffer of locator_max_len elements.
  */
 static void _rs_get_locator_poly(const RS_t* rs, const uint16_t* positions, uint16_t positions_cnt,
-                                 element_t* locator_poly, uint16_t locator_max_len) {
+                                 element_t* locator_poly, uint16_t locator_max_len, element_t* buffer) {
     assert(rs != NULL);
     assert(positions != NULL);
     assert(locator_poly != NULL);
+    assert(buffer != NULL);
     assert(positions_cnt + 1 <= locator_max_len);
 
     GF_t* gf = rs->gf;
-    element_t* pow_table = gf->pow_table;
+    const element_t* pow_table = gf->pow_table;
 
     locator_poly[0] = 1;
     for (uint16_t d = 0; d < positions_cnt; ++d) {
+        size_t size = (d + 1) * sizeof(element_t);
+
+        memcpy((void*)buffer, (void*)locator_poly, size);
         locator_poly[d + 1] = 0;
-        uint16_t pos = positions[d];
-        element_t coef = pow_table[pos];
+        gf_madd(gf, (void*)(locator_poly + 1), pow_table[positions[d]], (void*)buffer, size);
+    }
+}
+
+/**
+ * @brief Multiply polynomials with element coefficients by Karatsuba algorithm.
+ * @details Polynomials are split like in _rs_karatsuba_mul(...), coefficients are added and scaled by symbol
+ * arithmetic kernels as arrays of elements. Products of at most RS_LOCATOR_TREE_BASE_LEN coefficients are computed by
+ * schoolbook algorithm.
+ *
+ * @param gf Galois field data.
+ * @param ws workspace.
+ * @param a coefficients of the first polynomial.
+ * @param b coefficients of the second polynomial.
+ * @param n number of coefficients of each polynomial.
+ * @param res where to place 2n - 1 product coefficients.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+static int _rs_poly_mul(GF_t* gf, workspace_t* ws, const element_t* a, const element_t* b, uint32_t n,
+                        element_t* res) {
+    if (n <= RS_LOCATOR_TREE_BASE_LEN) {
+        memset((void*)res, 0, (2 * n - 1) * sizeof(element_t));
+        for (uint32_t i = 0; i < n; ++i)
+            gf_madd(gf, (void*)(res + i), a[i], (const void*)b, n * sizeof(element_t));
+
+        return 0;
+    }
+
+    uint32_t h = n - n / 2;
+    uint32_t l = n / 2;
+    element_t* a_sum;
+    element_t* b_sum;
+    element_t* p2;
+    int err;
+
+    err = _rs_poly_mul(gf, ws, a, b, h, res);
+    if (!err)
+        err = _rs_poly_mul(gf, ws, a + h, b + h, l, res + 2 * h);
+    if (err)
+        return err;
+    res[2 * h - 1] = 0;
+
+    size_t mark = workspace_mark(ws);
+
+    a_sum = (element_t*)workspace_alloc(ws, (4 * (size_t)h - 1) * sizeof(element_t));
+    if (!a_sum)
+        return 1;
+    b_sum = a_sum + h;
+    p2 = b_sum + h;
+
+    memcpy((void*)a_sum, (const void*)a, h * sizeof(element_t));
+    memcpy((void*)b_sum, (const void*)b, h * sizeof(element_t));
+    gf_add_symbols(gf, (void*)a_sum, (const void*)(a + h), l * sizeof(element_t));
+    gf_add_symbols(gf, (void*)b_sum, (const void*)(b + h), l * sizeof(element_t));
+
+    err = _rs_poly_mul(gf, ws, a_sum, b_sum, h, p2);
+
+    if (!err) {
+        gf_add_symbols(gf, (void*)p2, (const void*)res, (2 * h - 1) * sizeof(element_t));
+        gf_add_symbols(gf, (void*)p2, (const void*)(res + 2 * h), (2 * l - 1) * sizeof(element_t));
+        gf_add_symbols(gf, (void*)(res + h), (const void*)p2, (2 * h - 1) * sizeof(element_t));
+    }
+
+    workspace_release(ws, mark);
+
+    return err;
+}
 
-        for (uint16_t i = d + 1; i > 0; --i)
-            locator_poly[i] ^= gf_mul_ee(gf, locator_poly[i - 1], coef);
+/**
+ * @brief Compute locator polynomial by product tree.
+ * @details Positions are split in halves, locator polynomials of the halves are computed recursively and multiplied by
+ * _rs_poly_mul(...). Locator polynomials of less than RS_LOCATOR_TREE_MIN_LEN positions are computed by
+ * _rs_get_locator_poly(...).
+ *
+ * @param rs context object.
+ * @param positions positions.
+ * @param positions_cnt number of positions.
+ * @param locator_poly where to place (positions_cnt + 1) locator polynomial coefficients.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+static int _rs_get_locator_poly_tree(const RS_t* rs, const uint16_t* positions, uint16_t positions_cnt,
+                                     element_t* locator_poly) {
+    assert(rs != NULL);
+    assert(positions != NULL || positions_cnt == 0);
+    assert(locator_poly != NULL);
+
+    workspace_t* ws = rs->workspace;
+    uint16_t h = positions_cnt / 2;
+    uint16_t l = positions_cnt - h;
+    uint32_t n = (uint32_t)l + 1; // the first half has at most as many coefficients, it is padded by zero
+    element_t* lo;
+    element_t* hi;
+    element_t* prod;
+    int err;
+
+    size_t mark = workspace_mark(ws);
+
+    if (positions_cnt < RS_LOCATOR_TREE_MIN_LEN) {
+        element_t* buffer = (element_t*)workspace_alloc(ws, ((size_t)positions_cnt + 1) * sizeof(element_t));
+        if (!buffer)
+            return 1;
+
+        _rs_get_locator_poly(rs, positions, positions_cnt, locator_poly, positions_cnt + 1, buffer);
+        workspace_release(ws, mark);
+
+        return 0;
     }
+
+    lo = (element_t*)workspace_alloc(ws, 4 * (size_t)n * sizeof(element_t));
+    if (!lo)
+        return 1;
+    hi = lo + n;
+    prod = hi + n;
+
+    lo[n - 1] = 0;
+    err = _rs_get_locator_poly_tree(rs, positions, h, lo);
+    if (!err)
+        err = _rs_get_locator_poly_tree(rs, positions + h, l, hi);
+    if (!err)
+        err = _rs_poly_mul(rs->gf, ws, lo, hi, n, prod);
+    if (!err)
+        memcpy((void*)locator_poly, (const void*)prod, ((size_t)positions_cnt + 1) * sizeof(element_t));
+
+    workspace_release(ws, mark);
+
+    return err;
 }
 
 /**
@@ -130,6 +332,7 @@ static void _rs_get_rep_symbols_locator_poly(const RS_t* rs, uint16_t r, const c
 #endif
 
     element_t coset_locator_poly[RS_COSET_LOCATOR_MAX_LEN] = {0};
+    element_t buffer[RS_COSET_LOCATOR_MAX_LEN];
     coset_t coset;
     uint16_t coset_elements[CC_MAX_COSET_SIZE];
     uint16_t d; // locator polynomial degree
@@ -145,7 +348,7 @@ static void _rs_get_rep_symbols_locator_poly(const RS_t* rs, uint16_t r, const c
         for (uint16_t i = 1; i < coset.size; ++i)
             coset_elements[i] = NEXT_COSET_ELEMENT(coset_elements[i - 1]);
 
-        _rs_get_locator_poly(rs, coset_elements, coset.size, coset_locator_poly, RS_COSET_LOCATOR_MAX_LEN);
+        _rs_get_locator_poly(rs, coset_elements, coset.size, coset_locator_poly, RS_COSET_LOCATOR_MAX_LEN, buffer);
 
 #ifndef NDEBUG
         for (uint16_t _i = 0; _i <= coset.size; ++_i)
@@ -175,114 +378,454 @@ static void _rs_get_rep_symbols_locator_poly(const RS_t* rs, uint16_t r, const c
 }
 
 /**
- * @brief Compute Forney coefficient for given symbol postion.
+ * @brief Compute Forney coefficients for given symbol postions.
+ * @details Forney coefficient of position pos: \f$\alpha^{pos} / \Lambda'(\alpha^{-pos})\f$. Derivative is a sum
+ * of odd locator polynomial coefficients multiplied by consecutive powers of \f$\alpha^{-2 pos}\f$, all divisors are
+ * inverted at once. For d >= RS_FORNEY_LOGS_MIN_LEN derivative values at all roots are given by
+ * fft_get_locator_logs(...) as logarithms of \f$\alpha^{-pos} \Lambda'(\alpha^{-pos})\f$, it is the inverse of
+ * Forney coefficient.
  *
  * @param rs context object.
  * @param locator_poly locator polynomial.
+ * @param roots positions of locator polynomial roots.
  * @param d degree of locator polynomial (number of repair symbols or erasures).
- * @param pos symbol position.
- * @return Forney coefficient.
+ * @param positions symbol positions.
+ * @param positions_cnt number of symbol positions.
+ * @param forney_coefs where to place the result.
+ * @return 0 on success, 1 on memory allocation error.
  */
-static element_t _rs_get_forney_coef(const RS_t* rs, const element_t* locator_poly, uint16_t d, uint16_t pos) {
+static int _rs_get_forney_coefs(const RS_t* rs, const element_t* locator_poly, const uint16_t* roots, uint16_t d,
+                                const uint16_t* positions, uint16_t positions_cnt, element_t* forney_coefs) {
     assert(rs != NULL);
     assert(locator_poly != NULL);
+    assert(roots != NULL);
+    assert(positions != NULL);
+    assert(forney_coefs != NULL);
 
     GF_t* gf = rs->gf;
-    element_t* pow_table = gf->pow_table;
-    element_t p; // divisible element = alpha^{position}
-    element_t q; // divisor = locator_poly'(alpha^{-position})
+    const element_t* pow_table = gf->pow_table;
+    uint16_t odd_cnt = (d + 1) / 2;
+    element_t* odd_coefs; // odd locator polynomial coefficients
+    element_t* terms;     // derivative terms
+    element_t* divisors;  // locator_poly'(alpha^{-position})
+
+    if (positions_cnt == 0)
+        return 0;
 
-    p = pow_table[pos];
-    q = 0;
-    for (uint16_t j = 0; j < d; j += 2) {
-        element_t coef = locator_poly[j + 1];
+    size_t mark = workspace_mark(rs->workspace);
 
-        if (coef == 0) {
+    if (d >= RS_FORNEY_LOGS_MIN_LEN) {
+        uint16_t* logs;
+        int err;
+
+        logs = (uint16_t*)workspace_alloc(rs->workspace, N * sizeof(uint16_t));
+        if (!logs)
+            return 1;
+
+        err = fft_get_locator_logs(gf, rs->workspace, roots, d, logs);
+
+        for (uint16_t e = 0; e < positions_cnt && !err; ++e)
+            forney_coefs[e] = pow_table[(N - logs[positions[e]]) % N];
+
+        workspace_release(rs->workspace, mark);
+
+        return err;
+    }
+
+    odd_coefs = (element_t*)workspace_alloc(rs->workspace, ((size_t)odd_cnt * 2 + positions_cnt) * sizeof(element_t));
+    if (!odd_coefs)
+        return 1;
+    terms = odd_coefs + odd_cnt;
+    divisors = terms + odd_cnt;
+
+    for (uint16_t j = 0; j < odd_cnt; ++j)
+        odd_coefs[j] = locator_poly[2 * j + 1];
+
+    for (uint16_t e = 0; e < positions_cnt; ++e) {
+        uint16_t pos = positions[e];
+        element_t q = 0;
+
+        gf_pow_elements(gf, terms, 0, (uint16_t)((2 * (uint32_t)(N - pos)) % N), odd_cnt);
+        gf_mul_elements(gf, terms, terms, odd_coefs, odd_cnt);
+
+        for (uint16_t j = 0; j < odd_cnt; ++j)
+            q ^= terms[j];
+
+        divisors[e] = q;
+        forney_coefs[e] = pow_table[pos];
+    }
+
+    gf_inv_elements(gf, divisors, divisors, positions_cnt);
+    gf_mul_elements(gf, forney_coefs, forney_coefs, divisors, positions_cnt);
+
+    workspace_release(rs->workspace, mark);
+
+    return 0;
+}
+
+/**
+ * @brief Multiply polynomial with element coefficients B by polynomial with symbol coefficients V by schoolbook
+ * algorithm: \f$res_j = \sum_i B_i V_{j-i}\f$, \f$j < res\_len\f$.
+ *
+ * @param gf Galois field data.
+ * @param b coefficients of B.
+ * @param v stripes of coefficients of V.
+ * @param n number of coefficients of B and V.
+ * @param res where to place stripes of the product coefficients.
+ * @param res_len number of computed product coefficients (at most 2n - 1).
+ * @param stripe_size stripe size in bytes.
+ * @warning pre: n <= RS_KARATSUBA_BASE_LEN
+ */
+static void _rs_schoolbook_mul(GF_t* gf, const element_t* b, void* const* v, uint16_t n, void* const* res,
+                               uint16_t res_len, size_t stripe_size) {
+    assert(n <= RS_KARATSUBA_BASE_LEN);
+    assert(res_len <= 2 * n - 1);
+
+    gf_coef_tables_t tables[RS_KARATSUBA_BASE_LEN];
+    const void* stripes[GF_MADD_MULTI_BATCH_SIZE];
+    uint16_t degrees[RS_KARATSUBA_BASE_LEN];
+    uint16_t degrees_cnt = 0;
+
+    for (uint16_t i = 0; i < n; ++i) {
+        if (b[i] == 0)
             continue;
-        } else if (coef == 1) {
-            q ^= pow_table[(j * (N - pos)) % N];
-        } else {
-            q ^= gf_mul_ee(gf, pow_table[(j * (N - pos)) % N], coef);
+
+        gf_prepare_coef(gf, tables + degrees_cnt, b[i]);
+        degrees[degrees_cnt++] = i;
+    }
+
+    for (uint16_t j = 0; j < res_len; ++j) {
+        memset(res[j], 0, stripe_size);
+
+        for (uint16_t first = 0; first < degrees_cnt;) {
+            uint16_t cnt = 0;
+
+            // degrees i with 0 <= j - i < n
+            while (first < degrees_cnt && degrees[first] + n <= j)
+                ++first;
+            while (first + cnt < degrees_cnt && cnt < GF_MADD_MULTI_BATCH_SIZE && degrees[first + cnt] <= j) {
+                stripes[cnt] = (const void*)v[j - degrees[first + cnt]];
+                ++cnt;
+            }
+
+            if (cnt == 0)
+                break;
+
+            gf->madd_multi(res[j], tables + first, stripes, cnt, stripe_size);
+            first += cnt;
+        }
+    }
+}
+
+/**
+ * @brief Multiply polynomial with element coefficients B by polynomial with symbol coefficients V by Karatsuba
+ * algorithm.
+ * @details \f$B V = P_0 + x^h (P_0 + P_1 + P_2) + x^{2h} P_1\f$, where \f$P_0 = B_{lo} V_{lo}\f$,
+ * \f$P_1 = B_{hi} V_{hi}\f$ and \f$P_2 = (B_{lo} + B_{hi}) (V_{lo} + V_{hi})\f$ are computed recursively, products
+ * of at most RS_KARATSUBA_BASE_LEN coefficients are computed by schoolbook algorithm.
+ *
+ * @param gf Galois field data.
+ * @param ws workspace.
+ * @param b coefficients of B.
+ * @param v stripes of coefficients of V.
+ * @param n number of coefficients of B and V.
+ * @param res where to place stripes of 2n - 1 product coefficients.
+ * @param stripe_size stripe size in bytes.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+static int _rs_karatsuba_mul(GF_t* gf, workspace_t* ws, const element_t* b, void* const* v, uint16_t n,
+                             void* const* res, size_t stripe_size) {
+    if (n <= RS_KARATSUBA_BASE_LEN) {
+        _rs_schoolbook_mul(gf, b, v, n, res, 2 * n - 1, stripe_size);
+        return 0;
+    }
+
+    uint16_t h = n - n / 2;
+    uint16_t l = n / 2;
+    element_t* b_sum;
+    void** v_sum;
+    void** p2;
+    uint8_t* data;
+    int err;
+
+    err = _rs_karatsuba_mul(gf, ws, b, v, h, res, stripe_size);
+    if (!err)
+        err = _rs_karatsuba_mul(gf, ws, b + h, v + h, l, res + 2 * h, stripe_size);
+    if (err)
+        return err;
+    memset(res[2 * h - 1], 0, stripe_size);
+
+    size_t mark = workspace_mark(ws);
+
+    b_sum = (element_t*)workspace_alloc(ws, h * sizeof(element_t));
+    v_sum = (void**)workspace_alloc(ws, (3 * (size_t)h - 1) * sizeof(void*));
+    data = (uint8_t*)workspace_alloc(ws, (3 * (size_t)h - 1) * stripe_size);
+    if (!b_sum || !v_sum || !data) {
+        workspace_release(ws, mark);
+        return 1;
+    }
+    p2 = v_sum + h;
+
+    for (uint16_t i = 0; i < 3 * h - 1; ++i)
+        v_sum[i] = (void*)(data + i * stripe_size);
+
+    for (uint16_t i = 0; i < h; ++i) {
+        b_sum[i] = b[i];
+        memcpy(v_sum[i], (const void*)v[i], stripe_size);
+
+        if (i < l) {
+            b_sum[i] ^= b[h + i];
+            gf_add_symbols(gf, v_sum[i], (const void*)v[h + i], stripe_size);
+        }
+    }
+
+    err = _rs_karatsuba_mul(gf, ws, b_sum, v_sum, h, p2, stripe_size);
+
+    if (!err) {
+        for (uint16_t i = 0; i < 2 * h - 1; ++i)
+            gf_add_symbols(gf, p2[i], (const void*)res[i], stripe_size);
+        for (uint16_t i = 0; i < 2 * l - 1; ++i)
+            gf_add_symbols(gf, p2[i], (const void*)res[2 * h + i], stripe_size);
+        for (uint16_t i = 0; i < 2 * h - 1; ++i)
+            gf_add_symbols(gf, res[h + i], (const void*)p2[i], stripe_size);
+    }
+
+    workspace_release(ws, mark);
+
+    return err;
+}
+
+/**
+ * @brief Compute the first n coefficients of product of polynomial with element coefficients B by polynomial with
+ * symbol coefficients V.
+ * @details \f$B V \bmod x^n = B_{lo} V_{lo} + x^h ((B_{lo} V_{hi} + B_{hi} V_{lo}) \bmod x^{n-h})\f$: the full
+ * product is computed by _rs_karatsuba_mul(...), truncated products are computed recursively.
+ *
+ * @param gf Galois field data.
+ * @param ws workspace.
+ * @param b coefficients of B.
+ * @param v stripes of coefficients of V.
+ * @param n number of coefficients of B, V and the result.
+ * @param res where to place stripes of the result.
+ * @param stripe_size stripe size in bytes.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+static int _rs_karatsuba_mul_low(GF_t* gf, workspace_t* ws, const element_t* b, void* const* v, uint16_t n,
+                                 void* const* res, size_t stripe_size) {
+    if (n <= RS_KARATSUBA_BASE_LEN) {
+        _rs_schoolbook_mul(gf, b, v, n, res, n, stripe_size);
+        return 0;
+    }
+
+    uint16_t h = n - n / 2;
+    uint16_t l = n / 2;
+    void** tmp;
+    uint8_t* data;
+    int err;
+
+    err = _rs_karatsuba_mul(gf, ws, b, v, h, res, stripe_size);
+    if (err)
+        return err;
+    if (2 * h - 1 < n)
+        memset(res[n - 1], 0, stripe_size);
+
+    size_t mark = workspace_mark(ws);
+
+    tmp = (void**)workspace_alloc(ws, l * sizeof(void*));
+    data = (uint8_t*)workspace_alloc(ws, l * stripe_size);
+    if (!tmp || !data) {
+        workspace_release(ws, mark);
+        return 1;
+    }
+
+    for (uint16_t i = 0; i < l; ++i)
+        tmp[i] = (void*)(data + i * stripe_size);
+
+    for (uint8_t part = 0; part < 2 && !err; ++part) {
+        err = part == 0 ? _rs_karatsuba_mul_low(gf, ws, b, v + h, l, tmp, stripe_size)
+                        : _rs_karatsuba_mul_low(gf, ws, b + h, v, l, tmp, stripe_size);
+
+        for (uint16_t i = 0; i < l && !err; ++i)
+            gf_add_symbols(gf, res[h + i], (const void*)tmp[i], stripe_size);
+    }
+
+    workspace_release(ws, mark);
+
+    return err;
+}
+
+/**
+ * @brief Compute evaluator polynomial modulo x^t by Karatsuba algorithm (see _rs_karatsuba_mul_low(...)).
+ * @details Symbols are processed by stripes of RS_KARATSUBA_STRIPE_SIZE bytes: temporary polynomials take about
+ * (6 * t) stripes.
+ *
+ * @param rs context object.
+ * @param syndrome_poly syndrome polynomial (deg == t - 1).
+ * @param locator_poly locator polynomial (deg == t).
+ * @param evaluator_poly where to place the result.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+static int _rs_get_evaluator_poly_karatsuba(const RS_t* rs, const symbol_seq_t* syndrome_poly,
+                                            const element_t* locator_poly, symbol_seq_t* evaluator_poly) {
+    size_t symbol_size = syndrome_poly->symbol_size;
+    uint16_t t = syndrome_poly->length;
+    void** syndrome_stripes;
+    void** evaluator_stripes;
+    int err = 0;
+
+    size_t mark = workspace_mark(rs->workspace);
+
+    syndrome_stripes = (void**)workspace_alloc(rs->workspace, 2 * (size_t)t * sizeof(void*));
+    if (!syndrome_stripes)
+        return 1;
+    evaluator_stripes = syndrome_stripes + t;
+
+    for (size_t offset = 0; offset < symbol_size && !err; offset += RS_KARATSUBA_STRIPE_SIZE) {
+        size_t stripe_size = MIN(RS_KARATSUBA_STRIPE_SIZE, symbol_size - offset);
+
+        for (uint16_t i = 0; i < t; ++i) {
+            syndrome_stripes[i] = (void*)(syndrome_poly->symbols[i]->data + offset);
+            evaluator_stripes[i] = (void*)(evaluator_poly->symbols[i]->data + offset);
         }
+
+        err = _rs_karatsuba_mul_low(rs->gf, rs->workspace, locator_poly, syndrome_stripes, t, evaluator_stripes,
+                                    stripe_size);
     }
 
-    return gf_div_ee(gf, p, q);
+    workspace_release(rs->workspace, mark);
+
+    return err;
 }
 
 /**
  * @brief Compute evaluator polynomial modulo x^t (t - number of repair symbols or erasures).
+ * @details Evaluator polynomial is a product of Toeplitz matrix of locator polynomial coefficients and syndrome
+ * polynomial: \f$\Omega_j = \sum_{d=0}^{j} \Lambda_d S_{j-d}\f$.\n
+ * Symbols are processed by stripes of RS_EVALUATOR_STRIPE_SIZE bytes, so syndrome and evaluator stripes stay in cache
+ * while all locator coefficients are applied. Locator coefficients are applied by blocks of GF_MADD_MULTI_BATCH_SIZE
+ * nonzero ones: each evaluator stripe is loaded and stored once per block. For t >= RS_KARATSUBA_MIN_LEN
+ * (RS_KARATSUBA_BINARY_MIN_LEN for binary locators) the product is computed by _rs_get_evaluator_poly_karatsuba(...).
  *
  * @param rs context object.
  * @param syndrome_poly information symbols syndrome polynomial (deg == t - 1).
  * @param locator_poly repair symbols locator polynomial (deg == t).
  * @param evaluator_poly where to place the result.
+ * @return 0 on success, 1 on memory allocation error.
  */
-static void _rs_get_evaluator_poly(const RS_t* rs, const symbol_seq_t* syndrome_poly, const element_t* locator_poly,
-                                   symbol_seq_t* evaluator_poly) {
+static int _rs_get_evaluator_poly(const RS_t* rs, const symbol_seq_t* syndrome_poly, const element_t* locator_poly,
+                                  symbol_seq_t* evaluator_poly) {
     assert(rs != NULL);
     assert(syndrome_poly != NULL);
     assert(locator_poly != NULL);
     assert(evaluator_poly != NULL);
     assert(syndrome_poly->symbol_size == evaluator_poly->symbol_size);
 
+    if (syndrome_poly->length >= RS_KARATSUBA_MIN_LEN) {
+        bool binary = true;
+
+        for (uint16_t d = 0; d < syndrome_poly->length && binary; ++d)
+            binary = locator_poly[d] <= 1;
+
+        if (!binary || syndrome_poly->length >= RS_KARATSUBA_BINARY_MIN_LEN)
+            return _rs_get_evaluator_poly_karatsuba(rs, syndrome_poly, locator_poly, evaluator_poly);
+    }
+
     GF_t* gf = rs->gf;
     size_t symbol_size = syndrome_poly->symbol_size;
     uint16_t r = syndrome_poly->length;
+    gf_coef_tables_t tables[GF_MADD_MULTI_BATCH_SIZE];
+    const void* stripes[GF_MADD_MULTI_BATCH_SIZE];
+    uint16_t* degrees;
+    uint16_t degrees_cnt = 0;
 
     // Evaluator polynomial initialization.
     for (uint16_t i = 0; i < r; ++i)
         memset((void*)evaluator_poly->symbols[i]->data, 0, symbol_size);
 
-    for (uint16_t i = 0; i < r; ++i) {
-        element_t coef = locator_poly[i];
+    size_t mark = workspace_mark(rs->workspace);
 
-        if (coef == 0)
-            continue;
+    degrees = (uint16_t*)workspace_alloc(rs->workspace, r * sizeof(uint16_t));
+    if (!degrees)
+        return 1;
 
-        for (uint16_t j = 0; j < r - i; ++j)
-            gf_madd(gf, (void*)evaluator_poly->symbols[i + j]->data, coef, (void*)syndrome_poly->symbols[j]->data,
-                    symbol_size);
+    for (uint16_t d = 0; d < r; ++d) {
+        if (locator_poly[d] != 0)
+            degrees[degrees_cnt++] = d;
     }
+
+    for (size_t offset = 0; offset < symbol_size; offset += RS_EVALUATOR_STRIPE_SIZE) {
+        size_t stripe_size = symbol_size - offset;
+        if (stripe_size > RS_EVALUATOR_STRIPE_SIZE)
+            stripe_size = RS_EVALUATOR_STRIPE_SIZE;
+
+        for (uint16_t first = 0; first < degrees_cnt; first += GF_MADD_MULTI_BATCH_SIZE) {
+            const uint16_t* block = degrees + first;
+            uint16_t block_cnt = degrees_cnt - first;
+            if (block_cnt > GF_MADD_MULTI_BATCH_SIZE)
+                block_cnt = GF_MADD_MULTI_BATCH_SIZE;
+
+            for (uint16_t i = 0; i < block_cnt; ++i)
+                gf_prepare_coef(gf, tables + i, locator_poly[block[i]]);
+
+            // Degrees are sorted, so only a prefix of the block contributes to the first outputs.
+            uint16_t cnt = 0;
+            for (uint16_t j = block[0]; j < r; ++j) {
+                while (cnt < block_cnt && block[cnt] <= j)
+                    ++cnt;
+
+                for (uint16_t i = 0; i < cnt; ++i)
+                    stripes[i] = (const void*)(syndrome_poly->symbols[j - block[i]]->data + offset);
+
+                gf->madd_multi((void*)(evaluator_poly->symbols[j]->data + offset), tables, stripes, cnt, stripe_size);
+            }
+        }
+    }
+
+    workspace_release(rs->workspace, mark);
+
+    return 0;
 }
 
 /**
  * @brief Compute repair symbols.
  *
  * @param rs context object.
- * @param locator_poly repair symbols locator polynomial.
  * @param evaluator_poly repair symbols evaluator polynomial.
- * @param rep_positions repair symbol positions.
+ * @param forney_coefs Forney coefficients of repair symbol positions.
  * @param rep_cosets repair symbol positions in form of cyclotomic cosets union.
  * @param rep_cosets_cnt number of repair symbol cyclotomic cosets.
  * @param rep_symbols where to place the result.
  * @return 0 on success, !0 on error.
  */
-static int _rs_get_repair_symbols(const RS_t* rs, const element_t* locator_poly, const symbol_seq_t* evaluator_poly,
-                                  const uint16_t* rep_positions, const coset_t* rep_cosets, uint16_t rep_cosets_cnt,
-                                  symbol_seq_t* rep_symbols) {
+static int _rs_get_repair_symbols(const RS_t* rs, const symbol_seq_t* evaluator_poly, const element_t* forney_coefs,
+                                  const coset_t* rep_cosets, uint16_t rep_cosets_cnt, symbol_seq_t* rep_symbols) {
     assert(rs != NULL);
-    assert(locator_poly != NULL);
     assert(evaluator_poly != NULL);
-    assert(rep_positions != NULL);
+    assert(forney_coefs != NULL);
     assert(rep_cosets != NULL);
     assert(rep_symbols != NULL);
     assert(evaluator_poly->symbol_size == rep_symbols->symbol_size);
 
-    GF_t* gf = rs->gf;
-    size_t symbol_size = evaluator_poly->symbol_size;
-    uint16_t r = rep_symbols->length;
-    int err;
-
-    err = fft_partial_transform_cycl(gf, evaluator_poly, rep_cosets, rep_cosets_cnt, rep_symbols);
-    if (err)
-        return err;
+    // repair symbol = forney_coef * evaluator(alpha^{-position})
+    return fft_partial_transform_cycl_parallel(rs->gf, rs->pool, rs->workspace, evaluator_poly, rep_cosets,
+                                               rep_cosets_cnt, forney_coefs, rep_symbols);
+}
 
-    for (uint16_t i = 0; i < r; ++i) {
-        element_t coef = _rs_get_forney_coef(rs, locator_poly, r, rep_positions[i]);
-        gf_mul(gf, (void*)rep_symbols->symbols[i]->data, coef, symbol_size);
-    }
+/**
+ * @brief Point symbols of a stripe sequence to bytes [offset; offset + stripe_size) of sequence symbols.
+ *
+ * @param seq sequence.
+ * @param offset stripe offset in bytes (must be divisible by 2).
+ * @param stripe_size stripe size in bytes (must be divisible by 2).
+ * @param stripe stripe sequence of the same length, its symbols will be modified.
+ */
+static void _rs_set_seq_stripe(const symbol_seq_t* seq, size_t offset, size_t stripe_size, symbol_seq_t* stripe) {
+    assert(seq->length == stripe->length);
+    assert(offset + stripe_size <= seq->symbol_size);
 
-    return 0;
+    for (size_t i = 0; i < seq->length; ++i)
+        stripe->symbols[i]->data = seq->symbols[i]->data + offset;
+    stripe->symbol_size = stripe_size;
 }
 
 /**
@@ -291,16 +834,19 @@ static int _rs_get_repair_symbols(const RS_t* rs, const element_t* locator_poly,
  * @param rs context object.
  * @param k number of information symbols.
  * @param locator_poly erased symbols locator polynomial.
+ * @param locator_roots positions of all erased symbols (roots of locator polynomial).
  * @param evaluator_poly erased symbols evaluator polynomial.
  * @param positions positions of all symbols.
  * @param is_erased indicates which symbols has been erased.
  * @param rcv_symbols received symbols, restored symbols will be written here.
+ * @return 0 on success, 1 on memory allocation error.
  */
-static void _rs_restore_erased(const RS_t* rs, uint16_t k, const element_t* locator_poly,
-                               const symbol_seq_t* evaluator_poly, const uint16_t* positions, const bool* is_erased,
-                               symbol_seq_t* rcv_symbols) {
+static int _rs_restore_erased(const RS_t* rs, uint16_t k, const element_t* locator_poly, const uint16_t* locator_roots,
+                              const symbol_seq_t* evaluator_poly, const uint16_t* positions, const bool* is_erased,
+                              symbol_seq_t* rcv_symbols) {
     assert(rs != NULL);
     assert(locator_poly != NULL);
+    assert(locator_roots != NULL);
     assert(evaluator_poly != NULL);
     assert(positions != NULL);
     assert(is_erased != NULL);
@@ -309,30 +855,399 @@ static void _rs_restore_erased(const RS_t* rs, uint16_t k, const element_t* loca
 
     GF_t* gf = rs->gf;
     size_t symbol_size = evaluator_poly->symbol_size;
-    element_t* pow_table = gf->pow_table;
-    element_t forney_coef;
-    element_t coef;
+    element_t* forney_coefs;
+    uint16_t* erased_positions;
+    symbol_t** erased_symbols;
+    symbol_seq_t erased_seq;
     uint16_t t = evaluator_poly->length;
-    uint16_t pos;
-    uint16_t j;
+    uint16_t erased_cnt = 0;
+    int err;
+
+    size_t mark = workspace_mark(rs->workspace);
+
+    forney_coefs = (element_t*)workspace_alloc(rs->workspace, k * sizeof(element_t));
+    erased_positions = (uint16_t*)workspace_alloc(rs->workspace, k * sizeof(uint16_t));
+    erased_symbols = (symbol_t**)workspace_alloc(rs->workspace, k * sizeof(symbol_t*));
+    if (!forney_coefs || !erased_positions || !erased_symbols) {
+        workspace_release(rs->workspace, mark);
+        return 1;
+    }
 
     for (uint16_t id = 0; id < k; ++id) {
         if (!is_erased[id])
             continue;
 
-        pos = positions[id];
-        forney_coef = _rs_get_forney_coef(rs, locator_poly, t, pos);
+        erased_positions[erased_cnt] = positions[id];
+        erased_symbols[erased_cnt] = rcv_symbols->symbols[id];
+        ++erased_cnt;
+    }
+
+    erased_seq.length = erased_cnt;
+    erased_seq.symbol_size = symbol_size;
+    erased_seq.symbols = erased_symbols;
 
-        memset((void*)rcv_symbols->symbols[id]->data, 0, symbol_size);
+    err = _rs_get_forney_coefs(rs, locator_poly, locator_roots, t, erased_positions, erased_cnt, forney_coefs);
 
-        j = (N - pos) % N;
+    // erased symbol = forney_coef * evaluator(alpha^{-position}), positions are not unions of cyclotomic cosets, so
+    // the cosets that contain them are computed as a whole
+    if (!err)
+        err = fft_partial_transform_cycl_components_parallel(gf, rs->pool, rs->workspace, evaluator_poly,
+                                                             erased_positions, forney_coefs, &erased_seq);
 
-        for (uint16_t i = 0; i < t; ++i) {
-            coef = gf_mul_ee(gf, forney_coef, pow_table[(i * j) % N]);
-            gf_madd(gf, (void*)rcv_symbols->symbols[id]->data, coef, (void*)evaluator_poly->symbols[i]->data,
-                    symbol_size);
+    workspace_release(rs->workspace, mark);
+
+    return err;
+}
+
+/**
+ * @brief Get points of the codeword of the additive engine.
+ * @details Repair symbols are values at points [0; r), information symbols - at points [p; p + k). Values at points
+ * [r; p) are never transmitted, so they are always erased, and values at points [p + k; n) are zero. Codewords are
+ * values of polynomials of degree less than (n - p) in novel basis. p is a power of 2 if such layout fits into the
+ * field, then repair symbols are computed by transforms of length p, otherwise p = r.
+ *
+ * @param k number of information symbols.
+ * @param r number of repair symbols.
+ * @param p where to place the first point of information symbols.
+ * @param n where to place the number of points (power of 2).
+ */
+static void _rs_additive_get_layout(uint16_t k, uint16_t r, uint32_t* p, uint32_t* n) {
+    uint32_t m = 1;
+
+    while (m < r)
+        m <<= 1;
+    *p = m + k <= AFFT_MAX_LENGTH ? m : r;
+
+    *n = 1;
+    while (*n < *p + k)
+        *n <<= 1;
+}
+
+/**
+ * @brief Restore erased values of the codeword of the additive engine.
+ * @details \f$g = \Lambda f\f$ has degree less than n and is known at all points (zero at erased ones), so it is
+ * interpolated by inverse transform, and erased values are \f$f(\omega_e) = g'(\omega_e) / \Lambda'(\omega_e)\f$.
+ *
+ * @param rs context object.
+ * @param symbols symbols[j] - value at j-th point, NULL for points which values are not needed.
+ * @param cnt number of points with symbols, values at points [cnt; n) are zero.
+ * @param is_erased is_erased[j] indicates that value at j-th point is unknown.
+ * @param n number of points.
+ * @param restore_from erased values at points [restore_from; cnt) will be written to symbols.
+ * @param symbol_size symbol size.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+static int _rs_additive_restore(RS_t* rs, symbol_t* const* symbols, uint32_t cnt, const bool* is_erased, uint32_t n,
+                                uint32_t restore_from, size_t symbol_size) {
+    assert(rs != NULL);
+    assert(symbols != NULL);
+    assert(is_erased != NULL);
+    assert(cnt <= n);
+
+    GF_t* gf = rs->gf;
+    const element_t* pow_table = gf->pow_table;
+    size_t stripe_size = MIN(symbol_size, RS_ADDITIVE_STRIPE_SIZE);
+    uint16_t* locator_logs;
+    symbol_seq_t* work;
+    int err;
+
+    size_t mark = workspace_mark(rs->workspace);
+
+    locator_logs = (uint16_t*)workspace_alloc(rs->workspace, n * sizeof(uint16_t));
+    work = workspace_alloc_seq(rs->workspace, n, stripe_size);
+    if (!locator_logs || !work) {
+        workspace_release(rs->workspace, mark);
+        return 1;
+    }
+
+    err = afft_get_locator_logs(gf, rs->workspace, is_erased, n, locator_logs);
+
+    for (size_t offset = 0; offset < symbol_size && !err; offset += stripe_size) {
+        size_t cur_stripe_size = MIN(stripe_size, symbol_size - offset);
+
+        work->symbol_size = cur_stripe_size;
+
+        for (uint32_t j = 0; j < n; ++j) {
+            void* dst = (void*)work->symbols[j]->data;
+
+            if (j >= cnt || is_erased[j]) {
+                memset(dst, 0, cur_stripe_size);
+                continue;
+            }
+
+            memcpy(dst, (const void*)(symbols[j]->data + offset), cur_stripe_size);
+            gf_mul(gf, dst, pow_table[locator_logs[j]], cur_stripe_size);
+        }
+
+        afft_inverse_transform(gf, work, 0);
+        afft_add_derivative(gf, work);
+        afft_transform(gf, work, 0);
+
+        for (uint32_t j = restore_from; j < cnt; ++j) {
+            if (!is_erased[j] || !symbols[j])
+                continue;
+
+            void* dst = (void*)(symbols[j]->data + offset);
+
+            memcpy(dst, (const void*)work->symbols[j]->data, cur_stripe_size);
+            gf_mul(gf, dst, pow_table[N - locator_logs[j]], cur_stripe_size);
+        }
+    }
+
+    workspace_release(rs->workspace, mark);
+
+    return err;
+}
+
+/**
+ * @brief Generate repair symbols by the additive engine.
+ * @details If p is a power of 2, the codeword polynomial has zero coefficients of \f$X_{n-p}, \dots, X_{n-1}\f$ iff
+ * the sum of its interpolations on blocks of p points is zero, so repair symbols are values at the first block of the
+ * sum of interpolations on blocks of information symbols. Otherwise repair symbols are restored as erased ones.
+ *
+ * @param rs context object.
+ * @param inf_symbols information symbols.
+ * @param rep_symbols where to place the result.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+static int _rs_additive_generate_repair_symbols(RS_t* rs, const symbol_seq_t* inf_symbols, symbol_seq_t* rep_symbols) {
+    GF_t* gf = rs->gf;
+    size_t symbol_size = inf_symbols->symbol_size;
+    size_t stripe_size = MIN(symbol_size, RS_ADDITIVE_STRIPE_SIZE);
+    uint16_t k = inf_symbols->length;
+    uint16_t r = rep_symbols->length;
+    uint32_t p;
+    uint32_t n;
+    symbol_seq_t* work;
+    symbol_seq_t* block;
+    int err;
+
+    if (r == 0)
+        return 0;
+
+    _rs_additive_get_layout(k, r, &p, &n);
+
+    size_t mark = workspace_mark(rs->workspace);
+
+    if (p & (p - 1)) {
+        symbol_t** symbols;
+        bool* is_erased;
+
+        symbols = (symbol_t**)workspace_alloc(rs->workspace, (p + k) * sizeof(symbol_t*));
+        is_erased = (bool*)workspace_alloc(rs->workspace, n * sizeof(bool));
+        if (!symbols || !is_erased) {
+            workspace_release(rs->workspace, mark);
+            return 1;
+        }
+        memset((void*)is_erased, 0, n * sizeof(bool));
+
+        for (uint32_t i = 0; i < r; ++i) {
+            symbols[i] = rep_symbols->symbols[i];
+            is_erased[i] = true;
+        }
+        for (uint32_t i = 0; i < k; ++i)
+            symbols[p + i] = inf_symbols->symbols[i];
+
+        err = _rs_additive_restore(rs, symbols, p + k, is_erased, n, 0, symbol_size);
+
+        workspace_release(rs->workspace, mark);
+
+        return err;
+    }
+
+    work = workspace_alloc_seq(rs->workspace, p, stripe_size);
+    block = workspace_alloc_seq(rs->workspace, p, stripe_size);
+    if (!work || !block) {
+        workspace_release(rs->workspace, mark);
+        return 1;
+    }
+
+    for (size_t offset = 0; offset < symbol_size; offset += stripe_size) {
+        size_t cur_stripe_size = MIN(stripe_size, symbol_size - offset);
+
+        work->symbol_size = cur_stripe_size;
+        block->symbol_size = cur_stripe_size;
+
+        // work = sum of interpolations on blocks of information symbols, the first block is interpolated in place
+        for (uint32_t first = 0; first < k; first += p) {
+            symbol_seq_t* dst = first == 0 ? work : block;
+
+            for (uint32_t i = 0; i < p; ++i) {
+                void* data = (void*)dst->symbols[i]->data;
+
+                if (first + i < k)
+                    memcpy(data, (const void*)(inf_symbols->symbols[first + i]->data + offset), cur_stripe_size);
+                else
+                    memset(data, 0, cur_stripe_size);
+            }
+
+            afft_inverse_transform(gf, dst, p + first);
+
+            if (dst == work)
+                continue;
+
+            for (uint32_t i = 0; i < p; ++i)
+                gf_add_symbols(gf, (void*)work->symbols[i]->data, (const void*)block->symbols[i]->data,
+                               cur_stripe_size);
         }
+
+        afft_transform(gf, work, 0);
+
+        for (uint16_t i = 0; i < r; ++i)
+            memcpy((void*)(rep_symbols->symbols[i]->data + offset), (const void*)work->symbols[i]->data,
+                   cur_stripe_size);
     }
+
+    workspace_release(rs->workspace, mark);
+
+    return 0;
+}
+
+/**
+ * @brief Restore erased information symbols by the additive engine.
+ *
+ * @param rs context object.
+ * @param k number of information symbols.
+ * @param r number of repair symbols.
+ * @param rcv_symbols received symbols, restored symbols will be written here.
+ * @param is_erased indicates which symbols has been erased.
+ * @param t number of erases.
+ * @return 0 on success, 1 on memory allocation error.
+ */
+static int _rs_additive_restore_symbols(RS_t* rs, uint16_t k, uint16_t r, symbol_seq_t* rcv_symbols,
+                                        const bool* is_erased, uint16_t t) {
+    uint32_t p;
+    uint32_t n;
+    symbol_t** symbols;
+    bool* is_erased_point;
+    int err;
+
+    if (t == 0)
+        return 0;
+
+    _rs_additive_get_layout(k, r, &p, &n);
+
+    size_t mark = workspace_mark(rs->workspace);
+
+    symbols = (symbol_t**)workspace_alloc(rs->workspace, (p + k) * sizeof(symbol_t*));
+    is_erased_point = (bool*)workspace_alloc(rs->workspace, n * sizeof(bool));
+    if (!symbols || !is_erased_point) {
+        workspace_release(rs->workspace, mark);
+        return 1;
+    }
+    memset((void*)is_erased_point, 0, n * sizeof(bool));
+
+    for (uint32_t i = 0; i < p; ++i) {
+        symbols[i] = i < r ? rcv_symbols->symbols[k + i] : NULL;
+        is_erased_point[i] = i < r ? is_erased[k + i] : true;
+    }
+    for (uint32_t i = 0; i < k; ++i) {
+        symbols[p + i] = rcv_symbols->symbols[i];
+        is_erased_point[p + i] = is_erased[i];
+    }
+
+    err = _rs_additive_restore(rs, symbols, p + k, is_erased_point, n, p, rcv_symbols->symbol_size);
+
+    workspace_release(rs->workspace, mark);
+
+    return err;
+}
+
+rs_plan_t* rs_plan_create(RS_t* rs, uint16_t k, uint16_t r) {
+    assert(rs != NULL);
+    assert((uint32_t)k + r <= N);
+
+    rs_plan_t* plan;
+    uint16_t inf_max_cnt = 0;
+    uint16_t rep_max_cnt = 0;
+
+    plan = (rs_plan_t*)malloc(sizeof(rs_plan_t));
+    if (!plan)
+        return NULL;
+    memset((void*)plan, 0, sizeof(rs_plan_t));
+
+    plan->k = k;
+    plan->r = r;
+
+    cc_estimate_cosets_cnt(k, r, &inf_max_cnt, &rep_max_cnt);
+
+    plan->inf_cosets = (coset_t*)calloc(inf_max_cnt + rep_max_cnt, sizeof(coset_t));
+    if (!plan->inf_cosets) {
+        free(plan);
+        return NULL;
+    }
+    plan->rep_cosets = plan->inf_cosets + inf_max_cnt;
+
+    plan->positions = (uint16_t*)calloc(k + r, sizeof(uint16_t));
+    if (!plan->positions) {
+        free(plan->inf_cosets);
+        free(plan);
+        return NULL;
+    }
+
+    plan->rep_locator_poly = (element_t*)calloc(2 * (size_t)r + 1, sizeof(element_t));
+    if (!plan->rep_locator_poly) {
+        free(plan->positions);
+        free(plan->inf_cosets);
+        free(plan);
+        return NULL;
+    }
+    plan->rep_forney_coefs = plan->rep_locator_poly + r + 1;
+
+    cc_select_cosets(rs->cc, k, r, plan->inf_cosets, inf_max_cnt, &plan->inf_cosets_cnt, plan->rep_cosets,
+                     rep_max_cnt, &plan->rep_cosets_cnt);
+
+    cc_cosets_to_positions(plan->inf_cosets, plan->inf_cosets_cnt, plan->positions, k);
+    cc_cosets_to_positions(plan->rep_cosets, plan->rep_cosets_cnt, plan->positions + k, r);
+
+    if (r >= RS_LOCATOR_TREE_MIN_LEN) {
+        if (_rs_get_locator_poly_tree(rs, plan->positions + k, r, plan->rep_locator_poly)) {
+            rs_plan_destroy(plan);
+            return NULL;
+        }
+    } else {
+        _rs_get_rep_symbols_locator_poly(rs, r, plan->rep_cosets, plan->rep_cosets_cnt, plan->rep_locator_poly, r + 1);
+    }
+
+    if (_rs_get_forney_coefs(rs, plan->rep_locator_poly, plan->positions + k, r, plan->positions + k, r,
+                             plan->rep_forney_coefs)) {
+        rs_plan_destroy(plan);
+        return NULL;
+    }
+
+    return plan;
+}
+
+void rs_plan_destroy(rs_plan_t* plan) {
+    assert(plan != NULL);
+
+    free(plan->rep_locator_poly);
+    free(plan->positions);
+    free(plan->inf_cosets);
+    free(plan);
+}
+
+/**
+ * @brief Get plan of the given code parameters kept in the context object, the plan is replaced if parameters differ.
+ *
+ * @param rs context object.
+ * @param k number of information symbols.
+ * @param r number of repair symbols.
+ * @return plan on success and NULL on memory allocation error.
+ */
+static const rs_plan_t* _rs_get_plan(RS_t* rs, uint16_t k, uint16_t r) {
+    if (rs->plan && rs->plan->k == k && rs->plan->r == r)
+        return rs->plan;
+
+    rs_plan_t* plan = rs_plan_create(rs, k, r);
+    if (!plan)
+        return NULL;
+
+    if (rs->plan)
+        rs_plan_destroy(rs->plan);
+    rs->plan = plan;
+
+    return plan;
 }
 
 int rs_generate_repair_symbols(RS_t* rs, const symbol_seq_t* inf_symbols, symbol_seq_t* rep_symbols) {
@@ -342,102 +1257,138 @@ int rs_generate_repair_symbols(RS_t* rs, const symbol_seq_t* inf_symbols, symbol
     assert(inf_symbols->length + rep_symbols->length <= N);
     assert(inf_symbols->symbol_size == rep_symbols->symbol_size);
 
-    CC_t* cc = rs->cc;
+    if (rs->engine == RS_ENGINE_ADDITIVE)
+        return _rs_additive_generate_repair_symbols(rs, inf_symbols, rep_symbols);
+
+    if (rep_symbols->length == 0)
+        return 0;
+
+    const rs_plan_t* plan = _rs_get_plan(rs, inf_symbols->length, rep_symbols->length);
+    if (!plan)
+        return 1;
+
+    return rs_plan_generate_repair_symbols(rs, plan, inf_symbols, rep_symbols);
+}
+
+int rs_plan_generate_repair_symbols(RS_t* rs, const rs_plan_t* plan, const symbol_seq_t* inf_symbols,
+                                    symbol_seq_t* rep_symbols) {
+    assert(rs != NULL);
+    assert(plan != NULL);
+    assert(inf_symbols != NULL);
+    assert(rep_symbols != NULL);
+    assert(inf_symbols->length == plan->k);
+    assert(rep_symbols->length == plan->r);
+    assert(inf_symbols->symbol_size == rep_symbols->symbol_size);
+
+    if (rs->engine == RS_ENGINE_ADDITIVE)
+        return _rs_additive_generate_repair_symbols(rs, inf_symbols, rep_symbols);
+
     size_t symbol_size = inf_symbols->symbol_size;
-    uint16_t k = inf_symbols->length;
-    uint16_t r = rep_symbols->length;
-    uint16_t inf_max_cnt = 0;
-    uint16_t rep_max_cnt = 0;
-    uint16_t inf_cosets_cnt = 0;
-    uint16_t rep_cosets_cnt = 0;
-    coset_t* _cosets;
-    coset_t* inf_cosets;
-    coset_t* rep_cosets;
-    uint16_t* positions;
-    uint16_t* inf_positions;
-    uint16_t* rep_positions;
-    element_t* locator_poly;
+    size_t stripe_size = MIN(symbol_size, RS_ENCODE_STRIPE_SIZE);
+    uint16_t k = plan->k;
+    uint16_t r = plan->r;
+    symbol_t** _stripe_symbols;
+    symbol_seq_t inf_stripe;
+    symbol_seq_t rep_stripe;
     symbol_seq_t* syndrome_poly;
     symbol_seq_t* evaluator_poly;
-    int err;
+    int err = 0;
 
-    cc_estimate_cosets_cnt(k, r, &inf_max_cnt, &rep_max_cnt);
+    if (r == 0)
+        return 0;
 
-    _cosets = (coset_t*)calloc(inf_max_cnt + rep_max_cnt, sizeof(coset_t));
-    if (!_cosets)
-        return 1;
-    inf_cosets = _cosets;
-    rep_cosets = _cosets + inf_max_cnt;
+    size_t mark = workspace_mark(rs->workspace);
 
-    positions = (uint16_t*)calloc(k + r, sizeof(uint16_t));
-    if (!positions) {
-        free(_cosets);
+    // stripe sequences symbols: k + r pointers followed by k + r symbols
+    _stripe_symbols =
+        (symbol_t**)workspace_alloc(rs->workspace, ((size_t)k + r) * (sizeof(symbol_t*) + sizeof(symbol_t)));
+    syndrome_poly = workspace_alloc_seq(rs->workspace, r, stripe_size);
+    evaluator_poly = workspace_alloc_seq(rs->workspace, r, stripe_size);
+    if (!_stripe_symbols || !syndrome_poly || !evaluator_poly) {
+        workspace_release(rs->workspace, mark);
         return 1;
     }
-    inf_positions = positions;
-    rep_positions = positions + k;
 
-    locator_poly = (element_t*)calloc(r + 1, sizeof(element_t));
-    if (!locator_poly) {
-        free(positions);
-        free(_cosets);
-        return 1;
+    for (uint32_t i = 0; i < (uint32_t)k + r; ++i)
+        _stripe_symbols[i] = (symbol_t*)(_stripe_symbols + k + r) + i;
+
+    inf_stripe.length = k;
+    inf_stripe.symbols = _stripe_symbols;
+    rep_stripe.length = r;
+    rep_stripe.symbols = _stripe_symbols + k;
+
+    // all stages are computed independently for each byte column, so the whole pipeline runs stripe by stripe to keep
+    // syndrome and evaluator polynomials in cache
+    for (size_t offset = 0; offset < symbol_size && !err; offset += stripe_size) {
+        size_t cur_stripe_size = MIN(stripe_size, symbol_size - offset);
+
+        _rs_set_seq_stripe(inf_symbols, offset, cur_stripe_size, &inf_stripe);
+        _rs_set_seq_stripe(rep_symbols, offset, cur_stripe_size, &rep_stripe);
+        syndrome_poly->symbol_size = cur_stripe_size;
+        evaluator_poly->symbol_size = cur_stripe_size;
+
+        err = _rs_get_syndrome_poly(rs, &inf_stripe, plan->positions, syndrome_poly);
+        if (!err)
+            err = _rs_get_evaluator_poly(rs, syndrome_poly, plan->rep_locator_poly, evaluator_poly);
+        if (!err)
+            err = _rs_get_repair_symbols(rs, evaluator_poly, plan->rep_forney_coefs, plan->rep_cosets,
+                                         plan->rep_cosets_cnt, &rep_stripe);
     }
 
-    syndrome_poly = seq_create(r, symbol_size);
-    if (!syndrome_poly) {
-        free(locator_poly);
-        free(positions);
-        free(_cosets);
-        return 1;
-    }
+    workspace_release(rs->workspace, mark);
 
-    evaluator_poly = seq_create(r, symbol_size);
-    if (!evaluator_poly) {
-        seq_destroy(syndrome_poly);
-        free(locator_poly);
-        free(positions);
-        free(_cosets);
-        return 1;
-    }
+    return err;
+}
 
-    cc_select_cosets(cc, k, r, inf_cosets, inf_max_cnt, &inf_cosets_cnt, rep_cosets, rep_max_cnt, &rep_cosets_cnt);
+/**
+ * @brief Restore erased symbols without syndrome, locator and evaluator polynomials if erasures pattern allows it.
+ * @details Nothing is restored if no information symbol is erased. The 0-th Discrete Fourier transform component of
+ * codewords of cyclotomic engine is zero, so the sum of all codeword symbols is zero and a single erased symbol is the
+ * sum of all received ones (for r == 1 the repair symbol is the parity of information symbols).
+ *
+ * @param rs context object.
+ * @param k number of information symbols.
+ * @param rcv_symbols received symbols, restored symbols will be written here.
+ * @param is_erased indicates which symbols has been erased.
+ * @param t number of erases.
+ * @return true if symbols are restored, false if the full decoding is needed.
+ */
+static bool _rs_restore_trivial(const RS_t* rs, uint16_t k, symbol_seq_t* rcv_symbols, const bool* is_erased,
+                                uint16_t t) {
+    assert(rs != NULL);
+    assert(rcv_symbols != NULL);
+    assert(is_erased != NULL);
 
-    cc_cosets_to_positions(inf_cosets, inf_cosets_cnt, inf_positions, k);
-    cc_cosets_to_positions(rep_cosets, rep_cosets_cnt, rep_positions, r);
+    size_t symbol_size = rcv_symbols->symbol_size;
+    uint16_t n = (uint16_t)rcv_symbols->length;
+    uint16_t erased_id = n;
+    void* erased_data;
 
-    err = _rs_get_syndrome_poly(rs, inf_symbols, inf_positions, syndrome_poly);
-    if (err) {
-        seq_destroy(evaluator_poly);
-        seq_destroy(syndrome_poly);
-        free(locator_poly);
-        free(positions);
-        free(_cosets);
-        return err;
+    if (t == 0)
+        return true;
+
+    for (uint16_t id = 0; id < k; ++id) {
+        if (is_erased[id]) {
+            erased_id = id;
+            break;
+        }
     }
 
-    _rs_get_rep_symbols_locator_poly(rs, r, rep_cosets, rep_cosets_cnt, locator_poly, r + 1);
+    if (erased_id == n)
+        return true;
 
-    _rs_get_evaluator_poly(rs, syndrome_poly, locator_poly, evaluator_poly);
+    if (t != 1 || rs->engine != RS_ENGINE_CYCLOTOMIC)
+        return false;
 
-    err = _rs_get_repair_symbols(rs, locator_poly, evaluator_poly, rep_positions, rep_cosets, rep_cosets_cnt,
-                                 rep_symbols);
-    if (err) {
-        seq_destroy(evaluator_poly);
-        seq_destroy(syndrome_poly);
-        free(locator_poly);
-        free(positions);
-        free(_cosets);
-        return err;
-    }
+    erased_data = (void*)rcv_symbols->symbols[erased_id]->data;
+    memset(erased_data, 0, symbol_size);
 
-    seq_destroy(evaluator_poly);
-    seq_destroy(syndrome_poly);
-    free(locator_poly);
-    free(positions);
-    free(_cosets);
+    for (uint16_t id = 0; id < n; ++id) {
+        if (id != erased_id)
+            gf_add_symbols(rs->gf, erased_data, (const void*)rcv_symbols->symbols[id]->data, symbol_size);
+    }
 
-    return 0;
+    return true;
 }
 
 int rs_restore_symbols(RS_t* rs, uint16_t k, uint16_t r, symbol_seq_t* rcv_symbols, const bool* is_erased, uint16_t t) {
@@ -446,19 +1397,41 @@ int rs_restore_symbols(RS_t* rs, uint16_t k, uint16_t r, symbol_seq_t* rcv_symbo
     assert(is_erased != NULL);
     assert((k + r) == rcv_symbols->length);
 
-    CC_t* cc = rs->cc;
+    if (r < t) {
+        // Too many erases - symbols cannot be restored.
+        return RS_ERR_CANNOT_RESTORE;
+    }
+
+    // the plan is not needed
+    if (_rs_restore_trivial(rs, k, rcv_symbols, is_erased, t))
+        return 0;
+
+    if (rs->engine == RS_ENGINE_ADDITIVE)
+        return _rs_additive_restore_symbols(rs, k, r, rcv_symbols, is_erased, t);
+
+    const rs_plan_t* plan = _rs_get_plan(rs, k, r);
+    if (!plan)
+        return 1;
+
+    return rs_plan_restore_symbols(rs, plan, rcv_symbols, is_erased, t);
+}
+
+int rs_plan_restore_symbols(RS_t* rs, const rs_plan_t* plan, symbol_seq_t* rcv_symbols, const bool* is_erased,
+                            uint16_t t) {
+    assert(rs != NULL);
+    assert(plan != NULL);
+    assert(rcv_symbols != NULL);
+    assert(is_erased != NULL);
+    assert((plan->k + plan->r) == rcv_symbols->length);
+
     size_t symbol_size = rcv_symbols->symbol_size;
-    uint16_t inf_max_cnt = 0;
-    uint16_t rep_max_cnt = 0;
-    uint16_t inf_cosets_cnt = 0;
-    uint16_t rep_cosets_cnt = 0;
-    coset_t* _cosets;
-    coset_t* inf_cosets;
-    coset_t* rep_cosets;
-    uint16_t* positions;
-    uint16_t* inf_positions;
-    uint16_t* rep_positions;
+    uint16_t k = plan->k;
+    uint16_t r = plan->r;
+    const uint16_t* positions = plan->positions;
     uint16_t* erased_positions;
+    uint16_t* received_positions;
+    symbol_t** received_data;
+    symbol_seq_t received_symbols;
     element_t* locator_poly;
     symbol_seq_t* syndrome_poly;
     symbol_seq_t* evaluator_poly;
@@ -469,91 +1442,56 @@ int rs_restore_symbols(RS_t* rs, uint16_t k, uint16_t r, symbol_seq_t* rcv_symbo
         return RS_ERR_CANNOT_RESTORE;
     }
 
-    cc_estimate_cosets_cnt(k, r, &inf_max_cnt, &rep_max_cnt);
-
-    _cosets = (coset_t*)calloc(inf_max_cnt + rep_max_cnt, sizeof(coset_t));
-    if (!_cosets)
-        return 1;
-    inf_cosets = _cosets;
-    rep_cosets = _cosets + inf_max_cnt;
+    if (_rs_restore_trivial(rs, k, rcv_symbols, is_erased, t))
+        return 0;
 
-    positions = (uint16_t*)calloc(k + r, sizeof(uint16_t));
-    if (!positions) {
-        free(_cosets);
-        return 1;
-    }
-    inf_positions = positions;
-    rep_positions = positions + k;
+    if (rs->engine == RS_ENGINE_ADDITIVE)
+        return _rs_additive_restore_symbols(rs, k, r, rcv_symbols, is_erased, t);
 
-    erased_positions = (uint16_t*)calloc(t, sizeof(uint16_t));
-    if (!erased_positions) {
-        free(positions);
-        free(_cosets);
-        return 1;
-    }
-
-    locator_poly = (element_t*)calloc(t + 1, sizeof(element_t));
-    if (!locator_poly) {
-        free(erased_positions);
-        free(positions);
-        free(_cosets);
-        return 1;
-    }
+    size_t mark = workspace_mark(rs->workspace);
 
-    syndrome_poly = seq_create(t, symbol_size);
-    if (!syndrome_poly) {
-        free(locator_poly);
-        free(erased_positions);
-        free(positions);
-        free(_cosets);
+    erased_positions = (uint16_t*)workspace_alloc(rs->workspace, (k + r) * sizeof(uint16_t));
+    received_data = (symbol_t**)workspace_alloc(rs->workspace, (k + r - t) * sizeof(symbol_t*));
+    locator_poly = (element_t*)workspace_alloc(rs->workspace, (t + 1) * sizeof(element_t));
+    syndrome_poly = workspace_alloc_seq(rs->workspace, t, symbol_size);
+    evaluator_poly = workspace_alloc_seq(rs->workspace, t, symbol_size);
+    if (!erased_positions || !received_data || !locator_poly || !syndrome_poly || !evaluator_poly) {
+        workspace_release(rs->workspace, mark);
         return 1;
     }
+    received_positions = erased_positions + t;
 
-    evaluator_poly = seq_create(t, symbol_size);
-    if (!evaluator_poly) {
-        seq_destroy(syndrome_poly);
-        free(locator_poly);
-        free(erased_positions);
-        free(positions);
-        free(_cosets);
-        return 1;
+    uint16_t erased_cnt = 0;
+    uint16_t received_cnt = 0;
+    for (uint16_t i = 0; i < k + r; ++i) {
+        if (is_erased[i]) {
+            erased_positions[erased_cnt++] = positions[i];
+        } else {
+            received_positions[received_cnt] = positions[i];
+            received_data[received_cnt++] = rcv_symbols->symbols[i];
+        }
     }
+    assert(erased_cnt == t);
 
-    cc_select_cosets(cc, k, r, inf_cosets, inf_max_cnt, &inf_cosets_cnt, rep_cosets, rep_max_cnt, &rep_cosets_cnt);
-
-    cc_cosets_to_positions(inf_cosets, inf_cosets_cnt, inf_positions, k);
-    cc_cosets_to_positions(rep_cosets, rep_cosets_cnt, rep_positions, r);
+    received_symbols.length = received_cnt;
+    received_symbols.symbol_size = symbol_size;
+    received_symbols.symbols = received_data;
 
-    err = _rs_get_syndrome_poly(rs, rcv_symbols, positions, syndrome_poly);
+    // erased symbols are not read, so they do not have to be zeroed by the caller
+    err = _rs_get_syndrome_poly(rs, &received_symbols, received_positions, syndrome_poly);
     if (err) {
-        seq_destroy(evaluator_poly);
-        seq_destroy(syndrome_poly);
-        free(locator_poly);
-        free(erased_positions);
-        free(positions);
-        free(_cosets);
+        workspace_release(rs->workspace, mark);
         return err;
     }
 
-    uint16_t idx = 0;
-    for (uint16_t i = 0; i < k + r; ++i) {
-        if (!is_erased[i])
-            continue;
-        erased_positions[idx++] = positions[i];
-    }
-
-    _rs_get_locator_poly(rs, erased_positions, t, locator_poly, t + 1);
-
-    _rs_get_evaluator_poly(rs, syndrome_poly, locator_poly, evaluator_poly);
+    err = _rs_get_locator_poly_tree(rs, erased_positions, t, locator_poly);
+    if (!err)
+        err = _rs_get_evaluator_poly(rs, syndrome_poly, locator_poly, evaluator_poly);
+    if (!err)
+        err = _rs_restore_erased(rs, k, locator_poly, erased_positions, evaluator_poly, positions, is_erased,
+                                 rcv_symbols);
 
-    _rs_restore_erased(rs, k, locator_poly, evaluator_poly, positions, is_erased, rcv_symbols);
+    workspace_release(rs->workspace, mark);
 
-    seq_destroy(evaluator_poly);
-    seq_destroy(syndrome_poly);
-    free(locator_poly);
-    free(erased_positions);
-    free(positions);
-    free(_cosets);
-
-    return 0;
-}
\ No newline at end of file
+    return err;
+}
@@ -0,0 +1,58 @@
+/**
+ * @file cpu.c
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief util/cpu.h implementation.
+ * @date 2024-03-14
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <util/cpu.h>
+
+/**
+ * @brief Names of instruction set tiers (values of CPU_TIER_ENV environment variable).
+ */
+static const char* const g_tier_names[CPU_TIERS_CNT] = {[CPU_TIER_SCALAR] = "scalar",
+                                                        [CPU_TIER_SSSE3] = "ssse3",
+                                                        [CPU_TIER_AVX2] = "avx2",
+                                                        [CPU_TIER_AVX512BW] = "avx512bw"};
+
+cpu_tier_t cpu_detect_tier() {
+#ifdef CPU_X86
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+        return CPU_TIER_AVX512BW;
+    if (__builtin_cpu_supports("avx2"))
+        return CPU_TIER_AVX2;
+    if (__builtin_cpu_supports("ssse3"))
+        return CPU_TIER_SSSE3;
+#endif
+
+    return CPU_TIER_SCALAR;
+}
+
+cpu_tier_t cpu_select_tier() {
+    cpu_tier_t tier = cpu_detect_tier();
+    const char* forced = getenv(CPU_TIER_ENV);
+
+    if (!forced)
+        return tier;
+
+    for (int i = 0; i < CPU_TIERS_CNT; ++i) {
+        if (strcmp(forced, g_tier_names[i]) == 0)
+            return ((cpu_tier_t)i < tier) ? (cpu_tier_t)i : tier;
+    }
+
+    return tier;
+}
+
+const char* cpu_tier_name(cpu_tier_t tier) {
+    assert(tier < CPU_TIERS_CNT);
+
+    return g_tier_names[tier];
+}
@@ -0,0 +1,158 @@
+/**
+ * @file pool.c
+ * @author Matvey Kolesov (kolesov645@gmail.com)
+ * @brief util/pool.h implementation.
+ * @date 2024-04-09
+ *
+ * @copyright Copyright (c) 2024
+ */
+
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <util/pool.h>
+
+/**
+ * @brief Helper thread routine: run every started task once.
+ *
+ * @param arg thread pool.
+ * @return NULL.
+ */
+static void* _pool_worker(void* arg) {
+    pool_t* pool = (pool_t*)arg;
+    uint64_t generation = 0;
+
+    pthread_mutex_lock(&pool->mutex);
+
+    while (true) {
+        while (!pool->stop && pool->generation == generation)
+            pthread_cond_wait(&pool->start, &pool->mutex);
+
+        if (pool->stop)
+            break;
+
+        generation = pool->generation;
+
+        // task and its argument are not changed until all helper threads finish it
+        pthread_mutex_unlock(&pool->mutex);
+        pool->task(pool->arg);
+        pthread_mutex_lock(&pool->mutex);
+
+        if (--pool->running_cnt == 0)
+            pthread_cond_signal(&pool->done);
+    }
+
+    pthread_mutex_unlock(&pool->mutex);
+
+    return NULL;
+}
+
+/**
+ * @brief Stop and join helper threads.
+ *
+ * @param pool thread pool.
+ * @param cnt number of started helper threads.
+ */
+static void _pool_join(pool_t* pool, uint16_t cnt) {
+    pthread_mutex_lock(&pool->mutex);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (uint16_t i = 0; i < cnt; ++i)
+        pthread_join(pool->threads[i], NULL);
+}
+
+pool_t* pool_create(uint16_t threads_cnt) {
+    assert(threads_cnt > 0);
+
+    pool_t* pool;
+
+    pool = (pool_t*)malloc(sizeof(pool_t));
+    if (!pool)
+        return NULL;
+    memset((void*)pool, 0, sizeof(pool_t));
+
+    pool->threads_cnt = threads_cnt;
+
+    pool->threads = (pthread_t*)malloc(threads_cnt * sizeof(pthread_t)); // the last one is not used
+    if (!pool->threads) {
+        free(pool);
+        return NULL;
+    }
+
+    if (pthread_mutex_init(&pool->mutex, NULL)) {
+        free(pool->threads);
+        free(pool);
+        return NULL;
+    }
+
+    if (pthread_cond_init(&pool->start, NULL)) {
+        pthread_mutex_destroy(&pool->mutex);
+        free(pool->threads);
+        free(pool);
+        return NULL;
+    }
+
+    if (pthread_cond_init(&pool->done, NULL)) {
+        pthread_cond_destroy(&pool->start);
+        pthread_mutex_destroy(&pool->mutex);
+        free(pool->threads);
+        free(pool);
+        return NULL;
+    }
+
+    for (uint16_t i = 0; i + 1 < threads_cnt; ++i) {
+        if (pthread_create(pool->threads + i, NULL, _pool_worker, (void*)pool)) {
+            _pool_join(pool, i);
+            pthread_cond_destroy(&pool->done);
+            pthread_cond_destroy(&pool->start);
+            pthread_mutex_destroy(&pool->mutex);
+            free(pool->threads);
+            free(pool);
+            return NULL;
+        }
+    }
+
+    return pool;
+}
+
+void pool_destroy(pool_t* pool) {
+    assert(pool != NULL);
+
+    _pool_join(pool, pool->threads_cnt - 1);
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->mutex);
+    free(pool->threads);
+    free(pool);
+}
+
+uint16_t pool_get_threads_cnt(const pool_t* pool) {
+    return pool ? pool->threads_cnt : 1;
+}
+
+void pool_run(pool_t* pool, void (*task)(void* arg), void* arg) {
+    assert(task != NULL);
+
+    if (!pool || pool->threads_cnt == 1) {
+        task(arg);
+        return;
+    }
+
+    pthread_mutex_lock(&pool->mutex);
+    pool->task = task;
+    pool->arg = arg;
+    pool->running_cnt = pool->threads_cnt - 1;
+    ++pool->generation;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->mutex);
+
+    task(arg);
+
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->running_cnt != 0)
+        pthread_cond_wait(&pool->done, &pool->mutex);
+    pthread_mutex_unlock(&pool->mutex);
+}
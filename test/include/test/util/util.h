@@ -17,4 +17,6 @@ void util_init_rcv_symbols(const symbol_seq_t* src_symbols, symbol_seq_t* rcv_sy
 
 void util_choose_and_erase_symbols(symbol_seq_t* rcv_symbols, uint16_t t, bool* is_erased);
 
+void util_corrupt_erased_symbols(symbol_seq_t* rcv_symbols, const bool* is_erased);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,92 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rs/additive_fft.h>
+
+#define SEED 3016487
+#define MAX_LOG_N 10
+
+#define TEST_WRAPPER(_gf, _ws, _use_ws, _log_n, _erased_cnt)                                                          \
+    do {                                                                                                               \
+        if (test((_gf), (_use_ws) ? (_ws) : NULL, (_log_n), (_erased_cnt))) {                                         \
+            workspace_destroy((_ws));                                                                                  \
+            gf_destroy((_gf));                                                                                         \
+            return 1;                                                                                                  \
+        }                                                                                                              \
+    } while (0)
+
+static int test(GF_t* gf, workspace_t* ws, uint8_t log_n, uint32_t erased_cnt) {
+    static bool is_erased[1 << MAX_LOG_N];
+    static uint16_t res[1 << MAX_LOG_N];
+    uint32_t n = 1u << log_n;
+    int err;
+
+    for (uint32_t j = 0; j < n; ++j)
+        is_erased[j] = false;
+
+    for (uint32_t e = 0; e < erased_cnt;) {
+        uint32_t j = (uint32_t)rand() % n;
+
+        if (!is_erased[j]) {
+            is_erased[j] = true;
+            ++e;
+        }
+    }
+
+    err = afft_get_locator_logs(gf, ws, is_erased, n, res);
+    if (err) {
+        printf("ERROR: afft_get_locator_logs returned %d\n", err);
+        return err;
+    }
+
+    for (uint32_t j = 0; j < n; ++j) {
+        element_t value = 1;
+
+        for (uint32_t e = 0; e < n; ++e) {
+            if (is_erased[e] && e != j)
+                value = gf_mul_ee(gf, value, afft_get_point(j) ^ afft_get_point(e));
+        }
+
+        if (gf->pow_table[res[j]] != value) {
+            printf("ERROR: afft_get_locator_logs(*, *, %u, *) with %u erasures: value %u = %u != %u\n", n, erased_cnt,
+                   j, gf->pow_table[res[j]], value);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(void) {
+    GF_t* gf;
+    workspace_t* ws;
+
+    gf = gf_create();
+    if (!gf) {
+        printf("ERROR: gf_create returned NULL\n");
+        return 1;
+    }
+
+    ws = workspace_create();
+    if (!ws) {
+        printf("ERROR: workspace_create returned NULL\n");
+        gf_destroy(gf);
+        return 1;
+    }
+
+    srand(SEED);
+
+    for (uint8_t log_n = 0; log_n <= MAX_LOG_N; ++log_n) {
+        uint32_t n = 1u << log_n;
+
+        TEST_WRAPPER(gf, ws, true, log_n, 0);
+        TEST_WRAPPER(gf, ws, true, log_n, 1);
+        TEST_WRAPPER(gf, ws, false, log_n, (uint32_t)rand() % n + 1);
+        TEST_WRAPPER(gf, ws, true, log_n, n);
+    }
+
+    workspace_destroy(ws);
+    gf_destroy(gf);
+
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rs/additive_fft.h>
+
+#define SEED 8800913
+#define MAX_LOG_LENGTH 7
+#define MAX_SYMBOL_SIZE 130
+
+#define TEST_WRAPPER(_gf, _log_len, _offset, _symbol_size)                                                             \
+    do {                                                                                                               \
+        if (test((_gf), (_log_len), (_offset), (_symbol_size))) {                                                      \
+            seq_destroy(g_seq);                                                                                        \
+            gf_destroy((_gf));                                                                                         \
+            return 1;                                                                                                  \
+        }                                                                                                              \
+    } while (0)
+
+static symbol_seq_t* g_seq;
+
+/**
+ * @brief Compute value of novel basis polynomial X_i at the given point.
+ */
+static element_t novel_basis_value(GF_t* gf, uint32_t i, element_t x) {
+    element_t res = 1;
+    element_t s = x; // s_b(x)
+
+    for (uint8_t b = 0; b < AFFT_BASIS_SIZE; ++b) {
+        if (i & (1u << b))
+            res = gf_mul_ee(gf, res, s);
+        s = gf_mul_ee(gf, s, s) ^ s;
+    }
+
+    return res;
+}
+
+static int test(GF_t* gf, uint8_t log_len, uint32_t offset, size_t symbol_size) {
+    static element_t coefs[1 << MAX_LOG_LENGTH][MAX_SYMBOL_SIZE / sizeof(element_t)];
+    static element_t res[1 << MAX_LOG_LENGTH][MAX_SYMBOL_SIZE / sizeof(element_t)];
+    uint32_t len = 1u << log_len;
+    size_t cnt = symbol_size / sizeof(element_t);
+    symbol_seq_t seq = {.length = len, .symbol_size = symbol_size, .symbols = g_seq->symbols};
+    symbol_seq_t* f = &seq;
+
+    for (uint32_t i = 0; i < len; ++i) {
+        for (size_t e = 0; e < cnt; ++e)
+            coefs[i][e] = (i % 5 == 0) ? 0 : (element_t)rand();
+        memcpy((void*)f->symbols[i]->data, (const void*)coefs[i], symbol_size);
+    }
+
+    for (uint32_t j = 0; j < len; ++j) {
+        element_t point = afft_get_point(offset + j);
+
+        memset((void*)res[j], 0, symbol_size);
+        for (uint32_t i = 0; i < len; ++i) {
+            element_t value = novel_basis_value(gf, i, point);
+
+            for (size_t e = 0; e < cnt; ++e)
+                res[j][e] ^= gf_mul_ee(gf, value, coefs[i][e]);
+        }
+    }
+
+    afft_transform(gf, f, offset);
+
+    for (uint32_t j = 0; j < len; ++j) {
+        if (memcmp((const void*)f->symbols[j]->data, (const void*)res[j], symbol_size) != 0) {
+            printf("ERROR: [%s] afft_transform(*, {%u, %zu}, %u): value %u is wrong\n", cpu_tier_name(gf->tier), len,
+                   symbol_size, offset, j);
+            return 1;
+        }
+    }
+
+    afft_inverse_transform(gf, f, offset);
+
+    for (uint32_t i = 0; i < len; ++i) {
+        if (memcmp((const void*)f->symbols[i]->data, (const void*)coefs[i], symbol_size) != 0) {
+            printf("ERROR: [%s] afft_inverse_transform(*, {%u, %zu}, %u): coefficient %u is wrong\n",
+                   cpu_tier_name(gf->tier), len, symbol_size, offset, i);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(void) {
+    GF_t* gf;
+
+    gf = gf_create();
+    if (!gf) {
+        printf("ERROR: gf_create returned NULL\n");
+        return 1;
+    }
+
+    g_seq = seq_create(1 << MAX_LOG_LENGTH, MAX_SYMBOL_SIZE);
+    if (!g_seq) {
+        printf("ERROR: seq_create returned NULL\n");
+        gf_destroy(gf);
+        return 1;
+    }
+
+    srand(SEED);
+
+    for (int tier = CPU_TIER_SCALAR; tier <= (int)cpu_detect_tier(); ++tier) {
+        gf_set_tier(gf, (cpu_tier_t)tier);
+
+        for (uint8_t log_len = 0; log_len <= MAX_LOG_LENGTH; ++log_len) {
+            uint32_t offset = ((uint32_t)rand() % (AFFT_MAX_LENGTH >> log_len)) << log_len;
+
+            TEST_WRAPPER(gf, log_len, 0, 2);
+            TEST_WRAPPER(gf, log_len, offset, 2);
+            TEST_WRAPPER(gf, log_len, offset, 64);
+            TEST_WRAPPER(gf, log_len, offset, MAX_SYMBOL_SIZE);
+        }
+    }
+
+    seq_destroy(g_seq);
+    gf_destroy(gf);
+
+    return 0;
+}
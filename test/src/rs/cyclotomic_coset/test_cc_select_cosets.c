@@ -3,6 +3,10 @@
 #include <stdlib.h>
 
 #include <rs/cyclotomic_coset.h>
+#include <rs/prelude.h>
+
+#define SEED 4471023
+#define TESTS_CNT 100
 
 #define TEST_WRAPPER(_cc, _k, _r, _inf_cosets, _inf_cosets_cnt, _rep_cosets, _rep_cosets_cnt)                          \
     do {                                                                                                               \
@@ -95,6 +99,66 @@ static int test(CC_t* cc, uint16_t k, uint16_t r, const coset_t* inf_cosets, uin
     return ret;
 }
 
+static int test_cost(CC_t* cc, uint16_t k, uint16_t r) {
+    static bool is_used[N];
+    coset_t* inf_cosets;
+    coset_t* rep_cosets;
+    uint16_t inf_max_cnt;
+    uint16_t rep_max_cnt;
+    uint16_t inf_cosets_cnt;
+    uint16_t rep_cosets_cnt;
+    uint32_t inf_cnt = 0;
+    uint32_t rep_cnt = 0;
+    int ret = 0;
+
+    cc_estimate_cosets_cnt(k, r, &inf_max_cnt, &rep_max_cnt);
+
+    inf_cosets = (coset_t*)calloc(inf_max_cnt, sizeof(coset_t));
+    rep_cosets = (coset_t*)calloc(rep_max_cnt + 1, sizeof(coset_t)); // r may be 0
+    if (!inf_cosets || !rep_cosets) {
+        printf("ERROR: cannot allocate memory for cosets\n");
+        free(rep_cosets);
+        free(inf_cosets);
+        return 1;
+    }
+
+    cc_set_selection(cc, CC_SELECTION_COST);
+    cc_select_cosets(cc, k, r, inf_cosets, inf_max_cnt, &inf_cosets_cnt, rep_cosets, rep_max_cnt, &rep_cosets_cnt);
+    cc_set_selection(cc, CC_SELECTION_GREEDY);
+
+    // cosets are different, repair cosets contain exactly r positions, only the last information coset is partial
+    for (uint16_t i = 0; i < rep_cosets_cnt + inf_cosets_cnt && !ret; ++i) {
+        const coset_t* coset = i < rep_cosets_cnt ? rep_cosets + i : inf_cosets + (i - rep_cosets_cnt);
+
+        if (cc_get_coset_size(coset->leader) != coset->size || is_used[coset->leader]) {
+            printf("ERROR: cc_select_cosets(*, %u, %u, ...) [cost]: incorrect or repeated coset {%u, %u}\n", k, r,
+                   coset->leader, coset->size);
+            ret = 1;
+        }
+        is_used[coset->leader] = true;
+
+        if (i < rep_cosets_cnt)
+            rep_cnt += coset->size;
+        else if (i + 1 < rep_cosets_cnt + inf_cosets_cnt)
+            inf_cnt += coset->size;
+    }
+
+    if (!ret && (rep_cnt != r || inf_cnt >= k || inf_cnt + inf_cosets[inf_cosets_cnt - 1].size < k)) {
+        printf("ERROR: cc_select_cosets(*, %u, %u, ...) [cost]: incorrect number of positions\n", k, r);
+        ret = 1;
+    }
+
+    for (uint16_t i = 0; i < rep_cosets_cnt; ++i)
+        is_used[rep_cosets[i].leader] = false;
+    for (uint16_t i = 0; i < inf_cosets_cnt; ++i)
+        is_used[inf_cosets[i].leader] = false;
+
+    free(rep_cosets);
+    free(inf_cosets);
+
+    return ret;
+}
+
 int main(void) {
     CC_t* cc;
 
@@ -186,6 +250,46 @@ int main(void) {
         TEST_WRAPPER(cc, k, r, inf_cosets, inf_cosets_cnt, rep_cosets, rep_cosets_cnt);
     }
 
+    // Test 5
+    {
+        uint16_t k = 100;
+        uint16_t r = 30;
+        uint16_t inf_cosets_cnt = 7;
+        uint16_t rep_cosets_cnt = 5;
+        coset_t inf_cosets[] = {
+            {.leader = 1, .size = 16},
+            {.leader = 3, .size = 16},
+            {.leader = 5, .size = 16},
+            {.leader = 7, .size = 16},
+            {.leader = 9, .size = 16},
+            {.leader = 11, .size = 16},
+            {.leader = 13107, .size = 4},
+        };
+        coset_t rep_cosets[] = {
+            {.leader = 257, .size = 8},
+            {.leader = 771, .size = 8},
+            {.leader = 1285, .size = 8},
+            {.leader = 4369, .size = 4},
+            {.leader = 21845, .size = 2},
+        };
+
+        cc_set_selection(cc, CC_SELECTION_COST);
+        TEST_WRAPPER(cc, k, r, inf_cosets, inf_cosets_cnt, rep_cosets, rep_cosets_cnt);
+        cc_set_selection(cc, CC_SELECTION_GREEDY);
+    }
+
+    srand(SEED);
+
+    for (int _i = 0; _i < TESTS_CNT; ++_i) {
+        uint16_t k = 1 + rand() % 3000;
+        uint16_t r = rand() % 1000;
+
+        if (test_cost(cc, k, r)) {
+            cc_destroy(cc);
+            return 1;
+        }
+    }
+
     cc_destroy(cc);
 
     return 0;
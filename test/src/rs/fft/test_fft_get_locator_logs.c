@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rs/fft.h>
+
+#define SEED 5171829
+#define CHECKED_POINTS_CNT 64
+
+#define TEST_WRAPPER(_gf, _ws, _positions_cnt)                                                                         \
+    do {                                                                                                               \
+        if (test((_gf), (_ws), (_positions_cnt))) {                                                                    \
+            workspace_destroy((_ws));                                                                                  \
+            gf_destroy((_gf));                                                                                         \
+            return 1;                                                                                                  \
+        }                                                                                                              \
+    } while (0)
+
+static int check(GF_t* gf, const uint16_t* positions, uint16_t positions_cnt, const uint16_t* res, uint16_t j) {
+    element_t value = 1;
+
+    for (uint16_t i = 0; i < positions_cnt; ++i) {
+        if (positions[i] != j)
+            value = gf_mul_ee(gf, value, 1 ^ gf->pow_table[(positions[i] + N - j) % N]);
+    }
+
+    if (gf->pow_table[res[j]] != value) {
+        printf("ERROR: fft_get_locator_logs with %u positions: value %u = %u != %u\n", positions_cnt, j,
+               gf->pow_table[res[j]], value);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int test(GF_t* gf, workspace_t* ws, uint16_t positions_cnt) {
+    static bool is_position[N];
+    static uint16_t positions[N];
+    static uint16_t res[N];
+    int err;
+
+    for (uint16_t j = 0; j < N; ++j)
+        is_position[j] = false;
+
+    for (uint16_t i = 0; i < positions_cnt;) {
+        uint16_t j = (uint16_t)((uint32_t)rand() % N);
+
+        if (!is_position[j]) {
+            is_position[j] = true;
+            positions[i++] = j;
+        }
+    }
+
+    err = fft_get_locator_logs(gf, ws, positions, positions_cnt, res);
+    if (err) {
+        printf("ERROR: fft_get_locator_logs returned %d\n", err);
+        return err;
+    }
+
+    // values of derivative at some roots and values at some other points
+    for (uint16_t i = 0; i < CHECKED_POINTS_CNT && i < positions_cnt; ++i) {
+        if (check(gf, positions, positions_cnt, res, positions[(uint32_t)rand() % positions_cnt]))
+            return 1;
+    }
+
+    for (uint16_t i = 0; i < CHECKED_POINTS_CNT && positions_cnt < N;) {
+        uint16_t j = (uint16_t)((uint32_t)rand() % N);
+
+        if (is_position[j])
+            continue;
+        if (check(gf, positions, positions_cnt, res, j))
+            return 1;
+        ++i;
+    }
+
+    return 0;
+}
+
+int main(void) {
+    GF_t* gf;
+    workspace_t* ws;
+
+    gf = gf_create();
+    if (!gf) {
+        printf("ERROR: gf_create returned NULL\n");
+        return 1;
+    }
+
+    ws = workspace_create();
+    if (!ws) {
+        printf("ERROR: workspace_create returned NULL\n");
+        gf_destroy(gf);
+        return 1;
+    }
+
+    srand(SEED);
+
+    TEST_WRAPPER(gf, NULL, 0);
+    TEST_WRAPPER(gf, ws, 1);
+    TEST_WRAPPER(gf, ws, 2);
+    TEST_WRAPPER(gf, NULL, (uint16_t)((uint32_t)rand() % 1024 + 1));
+    TEST_WRAPPER(gf, ws, (uint16_t)((uint32_t)rand() % 1024 + 1));
+    TEST_WRAPPER(gf, ws, N / 2);
+    TEST_WRAPPER(gf, ws, N / 2 + 1);
+    TEST_WRAPPER(gf, ws, (uint16_t)(N / 2 + 1 + (uint32_t)rand() % (N / 2)));
+    TEST_WRAPPER(gf, ws, N - 1);
+    TEST_WRAPPER(gf, ws, N);
+
+    workspace_destroy(ws);
+    gf_destroy(gf);
+
+    return 0;
+}
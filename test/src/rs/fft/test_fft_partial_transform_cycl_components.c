@@ -0,0 +1,141 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rs/fft.h>
+
+#define SEED 7719033
+#define TESTS_CNT 20
+#define TEST_SYMBOL_SIZE 64
+
+#define TEST_WRAPPER(_gf, _pool, _ws, _use_pool, _use_ws, _f_len, _cnt)                                                \
+    do {                                                                                                               \
+        if (test((_gf), (_use_pool) ? (_pool) : NULL, (_use_ws) ? (_ws) : NULL, (_f_len), (_cnt))) {                   \
+            workspace_destroy((_ws));                                                                                  \
+            pool_destroy((_pool));                                                                                     \
+            gf_destroy((_gf));                                                                                         \
+            return 1;                                                                                                  \
+        }                                                                                                              \
+    } while (0)
+
+static int test(GF_t* gf, pool_t* pool, workspace_t* ws, uint16_t f_len, uint16_t cnt) {
+    static bool is_used[N];
+    symbol_seq_t* f;
+    symbol_seq_t* res;
+    symbol_seq_t* expected;
+    uint16_t* components;
+    element_t* scales;
+    int err = 0;
+
+    f = seq_create(f_len, TEST_SYMBOL_SIZE);
+    res = seq_create(cnt, TEST_SYMBOL_SIZE);
+    expected = seq_create(cnt, TEST_SYMBOL_SIZE);
+    components = (uint16_t*)malloc(cnt * sizeof(uint16_t));
+    scales = (element_t*)malloc(cnt * sizeof(element_t));
+    if (!f || !res || !expected || !components || !scales) {
+        printf("ERROR: couldn't allocate test data\n");
+        err = 1;
+        goto cleanup;
+    }
+
+    for (uint16_t i = 0; i < f_len; ++i) {
+        for (size_t j = 0; j < TEST_SYMBOL_SIZE; ++j)
+            f->symbols[i]->data[j] = (uint8_t)rand();
+    }
+
+    // neighbouring components often belong to the same cyclotomic coset
+    for (uint16_t i = 0; i < cnt; ++i) {
+        uint16_t c = (uint16_t)(rand() % N);
+
+        // elements of subfields belong to small cosets, which have their own expansion and output stages
+        if (rand() % 8 == 0) {
+            uint16_t order = (uint16_t)((1u << (1u << (rand() % 4))) - 1); // 2^m - 1 for m < 16
+            c = (uint16_t)(N / order * (rand() % order));
+        }
+        if (i > 0 && rand() % 2)
+            c = NEXT_COSET_ELEMENT(components[i - 1]);
+        while (is_used[c])
+            c = (uint16_t)((c + 1) % N);
+
+        is_used[c] = true;
+        components[i] = c;
+        scales[i] = (rand() % 4 == 0) ? 1 : (element_t)(1 + rand() % N);
+    }
+
+    fft_partial_transform(gf, f, components, expected);
+
+    for (uint16_t i = 0; i < cnt; ++i)
+        gf_mul(gf, (void*)expected->symbols[i]->data, scales[i], TEST_SYMBOL_SIZE);
+
+    err = fft_partial_transform_cycl_components_parallel(gf, pool, ws, f, components, scales, res);
+    if (err) {
+        printf("ERROR: fft_partial_transform_cycl_components_parallel returned %d\n", err);
+    } else if (!seq_eq(res, expected)) {
+        printf("ERROR: [%u threads] fft_partial_transform_cycl_components_parallel(*, *, {%u, *}, *, *, {%u, *}) != "
+               "scales * fft_partial_transform(...)\n",
+               pool_get_threads_cnt(pool), f_len, cnt);
+        err = 1;
+    }
+
+    for (uint16_t i = 0; i < cnt; ++i)
+        is_used[components[i]] = false;
+
+cleanup:
+    free(scales);
+    free(components);
+    if (expected)
+        seq_destroy(expected);
+    if (res)
+        seq_destroy(res);
+    if (f)
+        seq_destroy(f);
+
+    return err;
+}
+
+int main(void) {
+    GF_t* gf;
+    pool_t* pool;
+    workspace_t* ws;
+
+    gf = gf_create();
+    if (!gf) {
+        printf("ERROR: gf_create returned NULL\n");
+        return 1;
+    }
+
+    pool = pool_create(3);
+    if (!pool) {
+        printf("ERROR: pool_create returned NULL\n");
+        gf_destroy(gf);
+        return 1;
+    }
+
+    // shared workspace is reused by calls with different parameters
+    ws = workspace_create();
+    if (!ws) {
+        printf("ERROR: workspace_create returned NULL\n");
+        pool_destroy(pool);
+        gf_destroy(gf);
+        return 1;
+    }
+
+    srand(SEED);
+
+    TEST_WRAPPER(gf, pool, ws, false, false, 1, 1);
+    TEST_WRAPPER(gf, pool, ws, true, true, 5, 1);
+
+    for (int _i = 0; _i < TESTS_CNT; ++_i) {
+        uint16_t f_len = 1 + rand() % 300;
+        uint16_t cnt = 1 + rand() % 300;
+
+        TEST_WRAPPER(gf, pool, ws, false, false, f_len, cnt);
+        TEST_WRAPPER(gf, pool, ws, false, true, f_len, cnt);
+        TEST_WRAPPER(gf, pool, ws, true, true, f_len, cnt);
+    }
+
+    workspace_destroy(ws);
+    pool_destroy(pool);
+    gf_destroy(gf);
+
+    return 0;
+}
@@ -0,0 +1,61 @@
+#include <stdio.h>
+
+#include <rs/gf65536.h>
+
+static int test(GF_t* gf, uint8_t m) {
+    uint32_t order = (1u << m) - 1;
+    uint32_t used[GF_FIELD_SIZE / 32] = {0}; // used[repr] - repr is returned for some element
+
+    for (uint32_t d = 0; d < order; ++d) {
+        uint16_t repr = gf_get_normal_repr_reduced(gf, m, (uint16_t)d);
+        element_t elem = 0;
+
+        for (uint8_t j = 0; j < m; ++j) {
+            if (repr & (1u << j))
+                elem ^= gf_get_normal_basis_element(gf, m, j);
+        }
+
+        element_t expected = gf->pow_table[d * GF_SUBFIELD_GENERATOR_POWER(m)];
+        if (elem != expected) {
+            printf("ERROR: gf_get_normal_repr_reduced(*, %u, %u) = %u represents %u != %u\n", m, d, repr, elem,
+                   expected);
+            return 1;
+        }
+
+        if (used[repr >> 5] & (1u << (repr & 31))) {
+            printf("ERROR: gf_get_normal_repr_reduced(*, %u, *) returned %u twice\n", m, repr);
+            return 1;
+        }
+        used[repr >> 5] |= 1u << (repr & 31);
+
+        uint16_t repr_full = gf_get_normal_repr(gf, m, (uint16_t)(d * GF_SUBFIELD_GENERATOR_POWER(m)));
+        if (repr_full != repr) {
+            printf("ERROR: gf_get_normal_repr(*, %u, %u) = %u != %u\n", m, d * GF_SUBFIELD_GENERATOR_POWER(m),
+                   repr_full, repr);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(void) {
+    GF_t* gf;
+
+    gf = gf_create();
+    if (!gf) {
+        printf("ERROR: gf_create returned NULL\n");
+        return 1;
+    }
+
+    for (uint8_t m = 1; m <= CC_MAX_COSET_SIZE; m <<= 1) {
+        if (test(gf, m)) {
+            gf_destroy(gf);
+            return 1;
+        }
+    }
+
+    gf_destroy(gf);
+
+    return 0;
+}
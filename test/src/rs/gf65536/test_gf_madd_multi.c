@@ -0,0 +1,83 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rs/gf65536.h>
+
+#define SEED 5719043
+#define MAX_SYMBOL_SIZE 1300
+#define MAX_CNT 40
+
+#define TEST_WRAPPER(_gf, _cnt, _symbol_size)                                                                          \
+    do {                                                                                                               \
+        if (test((_gf), (_cnt), (_symbol_size))) {                                                                     \
+            gf_destroy((_gf));                                                                                         \
+            return 1;                                                                                                  \
+        }                                                                                                              \
+    } while (0)
+
+static int test(GF_t* gf, uint16_t cnt, size_t symbol_size) {
+    static element_t b[MAX_CNT][MAX_SYMBOL_SIZE / sizeof(element_t)];
+    element_t a[MAX_SYMBOL_SIZE / sizeof(element_t)];
+    element_t res[MAX_SYMBOL_SIZE / sizeof(element_t)];
+    element_t coefs[MAX_CNT];
+    const void* b_data[MAX_CNT];
+    size_t elements_cnt = symbol_size / sizeof(element_t);
+
+    for (uint16_t j = 0; j < cnt; ++j) {
+        coefs[j] = (j % 5 == 0) ? (element_t)(j % 2) : (element_t)rand();
+        b_data[j] = (const void*)b[j];
+    }
+
+    for (size_t i = 0; i < elements_cnt; ++i) {
+        a[i] = (element_t)rand();
+        res[i] = a[i];
+
+        for (uint16_t j = 0; j < cnt; ++j) {
+            b[j][i] = (i % 7 == 0) ? 0 : (element_t)rand();
+            res[i] ^= gf_mul_ee(gf, coefs[j], b[j][i]);
+        }
+    }
+
+    gf_madd_multi(gf, (void*)a, coefs, b_data, cnt, symbol_size);
+
+    for (size_t i = 0; i < elements_cnt; ++i) {
+        if (a[i] != res[i]) {
+            printf("ERROR: [%s] gf_madd_multi(*, *, *, *, %u, %zu): element %zu = %u != %u\n",
+                   cpu_tier_name(gf->tier), cnt, symbol_size, i, a[i], res[i]);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(void) {
+    GF_t* gf;
+
+    gf = gf_create();
+    if (!gf) {
+        printf("ERROR: gf_create returned NULL\n");
+        return 1;
+    }
+
+    srand(SEED);
+
+    for (int tier = CPU_TIER_SCALAR; tier <= (int)cpu_detect_tier(); ++tier) {
+        gf_set_tier(gf, (cpu_tier_t)tier);
+
+        TEST_WRAPPER(gf, 0, 64);
+        TEST_WRAPPER(gf, 1, 2);
+        TEST_WRAPPER(gf, 3, 30);
+        TEST_WRAPPER(gf, GF_MADD_MULTI_BATCH_SIZE, 128);
+        TEST_WRAPPER(gf, GF_MADD_MULTI_BATCH_SIZE + 1, 1300);
+        TEST_WRAPPER(gf, MAX_CNT, 1024);
+
+        for (size_t symbol_size = 2; symbol_size <= MAX_SYMBOL_SIZE; symbol_size += 2)
+            TEST_WRAPPER(gf, (uint16_t)(rand() % MAX_CNT + 1), symbol_size);
+    }
+
+    gf_destroy(gf);
+
+    return 0;
+}
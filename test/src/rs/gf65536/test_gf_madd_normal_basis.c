@@ -0,0 +1,77 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rs/gf65536.h>
+
+#define SEED 8301457
+#define MAX_SYMBOL_SIZE 1300
+
+#define TEST_WRAPPER(_gf, _m, _shift, _symbol_size)                                                                    \
+    do {                                                                                                               \
+        if (test((_gf), (_m), (_shift), (_symbol_size))) {                                                             \
+            gf_destroy((_gf));                                                                                         \
+            return 1;                                                                                                  \
+        }                                                                                                              \
+    } while (0)
+
+static int test(GF_t* gf, uint8_t m, uint8_t shift, size_t symbol_size) {
+    static element_t b[CC_MAX_COSET_SIZE][MAX_SYMBOL_SIZE / sizeof(element_t)];
+    element_t a[MAX_SYMBOL_SIZE / sizeof(element_t)];
+    element_t res[MAX_SYMBOL_SIZE / sizeof(element_t)];
+    const void* b_data[CC_MAX_COSET_SIZE];
+    size_t cnt = symbol_size / sizeof(element_t);
+
+    for (uint8_t t = 0; t < m; ++t)
+        b_data[t] = (const void*)b[t];
+
+    for (size_t i = 0; i < cnt; ++i) {
+        a[i] = (element_t)rand();
+        res[i] = a[i];
+
+        for (uint8_t t = 0; t < m; ++t) {
+            b[t][i] = (i % 7 == 0) ? 0 : (element_t)rand();
+            res[i] ^= gf_mul_ee(gf, gf_get_normal_basis_element(gf, m, (shift + t) % m), b[t][i]);
+        }
+    }
+
+    gf_madd_normal_basis(gf, (void*)a, m, shift, b_data, symbol_size);
+
+    for (size_t i = 0; i < cnt; ++i) {
+        if (a[i] != res[i]) {
+            printf("ERROR: [%s] gf_madd_normal_basis(*, *, %u, %u, *, %zu): element %zu = %u != %u\n",
+                   cpu_tier_name(gf->tier), m, shift, symbol_size, i, a[i], res[i]);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(void) {
+    GF_t* gf;
+
+    gf = gf_create();
+    if (!gf) {
+        printf("ERROR: gf_create returned NULL\n");
+        return 1;
+    }
+
+    srand(SEED);
+
+    for (int tier = CPU_TIER_SCALAR; tier <= (int)cpu_detect_tier(); ++tier) {
+        gf_set_tier(gf, (cpu_tier_t)tier);
+
+        for (uint8_t m = 1; m <= CC_MAX_COSET_SIZE; m <<= 1) {
+            for (uint8_t shift = 0; shift < m; ++shift) {
+                TEST_WRAPPER(gf, m, shift, 2);
+                TEST_WRAPPER(gf, m, shift, 130);
+                TEST_WRAPPER(gf, m, shift, MAX_SYMBOL_SIZE);
+            }
+        }
+    }
+
+    gf_destroy(gf);
+
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rs/gf65536.h>
+
+#define SEED 8912734
+#define MAX_SYMBOL_SIZE 1300
+
+#define TEST_WRAPPER(_gf, _coef, _symbol_size)                                                                         \
+    do {                                                                                                               \
+        if (test((_gf), (_coef), (_symbol_size))) {                                                                    \
+            gf_destroy((_gf));                                                                                         \
+            return 1;                                                                                                  \
+        }                                                                                                              \
+    } while (0)
+
+static int test(GF_t* gf, element_t coef, size_t symbol_size) {
+    element_t a[MAX_SYMBOL_SIZE / sizeof(element_t)];
+    element_t res[MAX_SYMBOL_SIZE / sizeof(element_t)];
+    size_t cnt = symbol_size / sizeof(element_t);
+
+    for (size_t i = 0; i < cnt; ++i) {
+        a[i] = (i % 7 == 0) ? 0 : (element_t)rand();
+        res[i] = gf_mul_ee(gf, coef, a[i]);
+    }
+
+    gf_mul(gf, (void*)a, coef, symbol_size);
+
+    for (size_t i = 0; i < cnt; ++i) {
+        if (a[i] != res[i]) {
+            printf("ERROR: [%s] gf_mul(*, *, %u, %zu): element %zu = %u != %u\n", cpu_tier_name(gf->tier), coef,
+                   symbol_size, i, a[i], res[i]);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(void) {
+    GF_t* gf;
+
+    gf = gf_create();
+    if (!gf) {
+        printf("ERROR: gf_create returned NULL\n");
+        return 1;
+    }
+
+    srand(SEED);
+
+    for (int tier = CPU_TIER_SCALAR; tier <= (int)cpu_detect_tier(); ++tier) {
+        gf_set_tier(gf, (cpu_tier_t)tier);
+
+        TEST_WRAPPER(gf, 0, 16);
+        TEST_WRAPPER(gf, 1, 16);
+        TEST_WRAPPER(gf, 2, 2);
+        TEST_WRAPPER(gf, 65535, 30);
+        TEST_WRAPPER(gf, 31981, 32);
+        TEST_WRAPPER(gf, 2491, 64);
+        TEST_WRAPPER(gf, 60895, 98);
+        TEST_WRAPPER(gf, 44234, 128);
+
+        for (size_t symbol_size = 2; symbol_size <= MAX_SYMBOL_SIZE; symbol_size += 2)
+            TEST_WRAPPER(gf, (element_t)rand(), symbol_size);
+    }
+
+    gf_destroy(gf);
+
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rs/gf65536.h>
+
+#define SEED 2741093
+#define MAX_CNT 1000
+
+#define TEST_WRAPPER(_gf, _cnt)                                                                                        \
+    do {                                                                                                               \
+        if (test((_gf), (_cnt))) {                                                                                     \
+            gf_destroy((_gf));                                                                                         \
+            return 1;                                                                                                  \
+        }                                                                                                              \
+    } while (0)
+
+static int test(GF_t* gf, size_t cnt) {
+    element_t a[MAX_CNT] = {0};
+    element_t b[MAX_CNT] = {0};
+    element_t res[MAX_CNT];
+
+    for (size_t i = 0; i < cnt; ++i) {
+        a[i] = (i % 5 == 0) ? 0 : (element_t)rand();
+        b[i] = (i % 7 == 0) ? 0 : (element_t)rand();
+        res[i] = gf_mul_ee(gf, a[i], b[i]);
+    }
+
+    gf_mul_elements(gf, a, a, b, cnt);
+
+    for (size_t i = 0; i < cnt; ++i) {
+        if (a[i] != res[i]) {
+            printf("ERROR: gf_mul_elements(*, *, *, *, %zu): element %zu = %u != %u\n", cnt, i, a[i], res[i]);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(void) {
+    GF_t* gf;
+
+    gf = gf_create();
+    if (!gf) {
+        printf("ERROR: gf_create returned NULL\n");
+        return 1;
+    }
+
+    srand(SEED);
+
+    TEST_WRAPPER(gf, 0);
+    TEST_WRAPPER(gf, 1);
+    TEST_WRAPPER(gf, 17);
+    TEST_WRAPPER(gf, MAX_CNT);
+
+    gf_destroy(gf);
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rs/gf65536.h>
+
+#define SEED 5520931
+#define MAX_SYMBOL_SIZE 1300
+
+#define TEST_WRAPPER(_gf, _m, _symbol_size, _scaled)                                                                   \
+    do {                                                                                                               \
+        if (test((_gf), (_m), (_symbol_size), (_scaled))) {                                                            \
+            gf_destroy((_gf));                                                                                         \
+            return 1;                                                                                                  \
+        }                                                                                                              \
+    } while (0)
+
+static int test(GF_t* gf, uint8_t m, size_t symbol_size, bool scaled) {
+    static element_t a[CC_MAX_COSET_SIZE][MAX_SYMBOL_SIZE / sizeof(element_t)];
+    static element_t b[CC_MAX_COSET_SIZE][MAX_SYMBOL_SIZE / sizeof(element_t)];
+    static element_t res[CC_MAX_COSET_SIZE][MAX_SYMBOL_SIZE / sizeof(element_t)];
+    static gf_coef_tables_t scales[CC_MAX_COSET_SIZE];
+    void* a_data[CC_MAX_COSET_SIZE];
+    const void* b_data[CC_MAX_COSET_SIZE];
+    size_t cnt = symbol_size / sizeof(element_t);
+
+    for (uint8_t t = 0; t < m; ++t) {
+        a_data[t] = (void*)a[t];
+        b_data[t] = (const void*)b[t];
+        gf_prepare_coef(gf, scales + t, (t % 3 == 0) ? 1 : (element_t)(1 + rand() % N));
+    }
+
+    for (size_t i = 0; i < cnt; ++i) {
+        for (uint8_t t = 0; t < m; ++t) {
+            a[t][i] = (element_t)rand();
+            b[t][i] = (i % 7 == 0) ? 0 : (element_t)rand();
+        }
+
+        for (uint8_t j = 0; j < m; ++j) {
+            res[j][i] = 0;
+
+            for (uint8_t t = 0; t < m; ++t)
+                res[j][i] ^= gf_mul_ee(gf, gf_get_normal_basis_element(gf, m, (j + t) % m), b[t][i]);
+
+            if (scaled)
+                res[j][i] = gf_mul_ee(gf, scales[j].coef, res[j][i]);
+        }
+    }
+
+    gf_normal_basis_convolution(gf, a_data, m, scaled ? scales : NULL, b_data, symbol_size);
+
+    for (uint8_t j = 0; j < m; ++j) {
+        for (size_t i = 0; i < cnt; ++i) {
+            if (a[j][i] != res[j][i]) {
+                printf("ERROR: [%s] gf_normal_basis_convolution(*, *, %u, %s, *, %zu): element %zu of destination %u "
+                       "= %u != %u\n",
+                       cpu_tier_name(gf->tier), m, scaled ? "*" : "NULL", symbol_size, i, j, a[j][i], res[j][i]);
+                return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+int main(void) {
+    GF_t* gf;
+
+    gf = gf_create();
+    if (!gf) {
+        printf("ERROR: gf_create returned NULL\n");
+        return 1;
+    }
+
+    srand(SEED);
+
+    for (int tier = CPU_TIER_SCALAR; tier <= (int)cpu_detect_tier(); ++tier) {
+        gf_set_tier(gf, (cpu_tier_t)tier);
+
+        for (uint8_t m = 1; m <= CC_MAX_COSET_SIZE; m <<= 1) {
+            for (int scaled = 0; scaled < 2; ++scaled) {
+                TEST_WRAPPER(gf, m, 2, scaled);
+                TEST_WRAPPER(gf, m, 130, scaled);
+                TEST_WRAPPER(gf, m, 256, scaled);
+                TEST_WRAPPER(gf, m, MAX_SYMBOL_SIZE, scaled);
+            }
+        }
+    }
+
+    gf_destroy(gf);
+
+    return 0;
+}
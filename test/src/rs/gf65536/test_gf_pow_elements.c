@@ -0,0 +1,52 @@
+#include <stdio.h>
+
+#include <rs/gf65536.h>
+
+#define MAX_CNT 1000
+
+#define TEST_WRAPPER(_gf, _start, _step, _cnt)                                                                         \
+    do {                                                                                                               \
+        if (test((_gf), (_start), (_step), (_cnt))) {                                                                  \
+            gf_destroy((_gf));                                                                                         \
+            return 1;                                                                                                  \
+        }                                                                                                              \
+    } while (0)
+
+static int test(GF_t* gf, uint16_t start, uint16_t step, size_t cnt) {
+    element_t res[MAX_CNT];
+
+    gf_pow_elements(gf, res, start, step, cnt);
+
+    for (size_t i = 0; i < cnt; ++i) {
+        element_t expected = gf->pow_table[((uint64_t)start + (uint64_t)i * step) % N];
+
+        if (res[i] != expected) {
+            printf("ERROR: gf_pow_elements(*, *, %u, %u, %zu): element %zu = %u != %u\n", start, step, cnt, i, res[i],
+                   expected);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+int main(void) {
+    GF_t* gf;
+
+    gf = gf_create();
+    if (!gf) {
+        printf("ERROR: gf_create returned NULL\n");
+        return 1;
+    }
+
+    TEST_WRAPPER(gf, 0, 0, 10);
+    TEST_WRAPPER(gf, 0, 1, MAX_CNT);
+    TEST_WRAPPER(gf, 65534, 1, 3);
+    TEST_WRAPPER(gf, 65535, 65535, 5);
+    TEST_WRAPPER(gf, 12345, 65534, MAX_CNT);
+    TEST_WRAPPER(gf, 40000, 50000, MAX_CNT);
+
+    gf_destroy(gf);
+
+    return 0;
+}
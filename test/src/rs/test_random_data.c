@@ -10,15 +10,15 @@
 #define SEED 234546127
 #define TESTS_CNT 100
 
-#define TEST_WRAPPER(_rs, _symbol_size, _k, _r, _t)                                                                    \
+#define TEST_WRAPPER(_rs, _plan, _symbol_size, _k, _r, _t)                                                             \
     do {                                                                                                               \
-        if (test((_rs), (_symbol_size), (_k), (_r), (_t))) {                                                           \
+        if (test((_rs), (_plan), (_symbol_size), (_k), (_r), (_t))) {                                                  \
             rs_destroy((_rs));                                                                                         \
             return 1;                                                                                                  \
         }                                                                                                              \
     } while (0)
 
-static int test(RS_t* rs, size_t symbol_size, uint16_t k, uint16_t r, uint16_t t) {
+static int test(RS_t* rs, const rs_plan_t* plan, size_t symbol_size, uint16_t k, uint16_t r, uint16_t t) {
     assert(t <= r);
 
     symbol_seq_t* src_symbols;
@@ -64,7 +64,10 @@ static int test(RS_t* rs, size_t symbol_size, uint16_t k, uint16_t r, uint16_t t
     rcv_inf_symbols.length = k;
     rcv_inf_symbols.symbols = rcv_symbols->symbols;
 
-    err = rs_generate_repair_symbols(rs, &inf_symbols, &rep_symbols);
+    if (plan)
+        err = rs_plan_generate_repair_symbols(rs, plan, &inf_symbols, &rep_symbols);
+    else
+        err = rs_generate_repair_symbols(rs, &inf_symbols, &rep_symbols);
     if (err) {
         printf("ERROR: rs_generate_repair_symbols returned %d\n", err);
         free(is_erased);
@@ -75,9 +78,13 @@ static int test(RS_t* rs, size_t symbol_size, uint16_t k, uint16_t r, uint16_t t
 
     util_init_rcv_symbols(src_symbols, rcv_symbols);
     util_choose_and_erase_symbols(rcv_symbols, t, is_erased);
-    assert(!seq_eq(src_symbols, rcv_symbols));
+    util_corrupt_erased_symbols(rcv_symbols, is_erased); // decoder must not read erased symbols
+    assert(t == 0 || !seq_eq(src_symbols, rcv_symbols));
 
-    err = rs_restore_symbols(rs, k, r, rcv_symbols, is_erased, t);
+    if (plan)
+        err = rs_plan_restore_symbols(rs, plan, rcv_symbols, is_erased, t);
+    else
+        err = rs_restore_symbols(rs, k, r, rcv_symbols, is_erased, t);
     if (err) {
         printf("ERROR: rs_restore_symbols returned %d\n", err);
         free(is_erased);
@@ -128,7 +135,7 @@ int main(void) {
         r = 50 + rand() % 50;
         t = 11 + rand() % (r - 10);
 
-        TEST_WRAPPER(rs, symbol_size, k, r, t);
+        TEST_WRAPPER(rs, NULL, symbol_size, k, r, t);
     }
 
     for (int _i = 0; _i < (TESTS_CNT + 1) / 2; ++_i) {
@@ -137,7 +144,67 @@ int main(void) {
         r = 50 + rand() % 50;
         t = r;
 
-        TEST_WRAPPER(rs, symbol_size, k, r, t);
+        TEST_WRAPPER(rs, NULL, symbol_size, k, r, t);
+    }
+
+    // no erasures, single erasure, parity and (mostly) erasures of repair symbols only
+    for (int _i = 0; _i < TESTS_CNT / 10; ++_i) {
+        symbol_size = 16;
+        k = 1 + rand() % 300;
+        r = 1 + rand() % 300;
+
+        TEST_WRAPPER(rs, NULL, symbol_size, k, r, 0);
+        TEST_WRAPPER(rs, NULL, symbol_size, k, r, 1);
+        TEST_WRAPPER(rs, NULL, symbol_size, k, 1, 1);
+        TEST_WRAPPER(rs, NULL, symbol_size, 1 + rand() % 3, r, 1 + rand() % r);
+    }
+
+    // locator polynomial product tree and Forney coefficients from logarithms of locator derivative values
+    for (int _i = 0; _i < 2; ++_i) {
+        symbol_size = 2;
+        k = 1 + rand() % 1000;
+        r = RS_LOCATOR_TREE_MIN_LEN + rand() % 1000;
+        t = r - _i * (r - RS_FORNEY_LOGS_MIN_LEN);
+
+        TEST_WRAPPER(rs, NULL, symbol_size, k, r, t);
+    }
+
+    rs_set_cosets_selection(rs, CC_SELECTION_COST);
+
+    for (int _i = 0; _i < TESTS_CNT / 2; ++_i) {
+        symbol_size = 16;
+        k = 1 + rand() % 300;
+        r = 1 + rand() % 300;
+        t = 1 + rand() % r;
+
+        TEST_WRAPPER(rs, NULL, symbol_size, k, r, t);
+    }
+
+    // plans created by the caller are reused for several blocks, interleaved with the plan kept in the context
+    for (int _i = 0; _i < TESTS_CNT / 10; ++_i) {
+        rs_plan_t* plan;
+
+        symbol_size = 16;
+        k = 1 + rand() % 300;
+        r = 1 + rand() % 300;
+        t = 1 + rand() % r;
+
+        plan = rs_plan_create(rs, k, r);
+        if (!plan) {
+            printf("ERROR: rs_plan_create returned NULL\n");
+            rs_destroy(rs);
+            return 1;
+        }
+
+        for (int _j = 0; _j < 3; ++_j) {
+            if (test(rs, plan, symbol_size, k, r, t) || test(rs, NULL, symbol_size, k, r, t)) {
+                rs_plan_destroy(plan);
+                rs_destroy(rs);
+                return 1;
+            }
+        }
+
+        rs_plan_destroy(plan);
     }
 
     rs_destroy(rs);
@@ -0,0 +1,146 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <rs/reed_solomon.h>
+#include <test/util/util.h>
+
+#define SEED 70211853
+#define WARMUP_CNT 2
+#define ITERATIONS_CNT 5
+
+// allocation functions are wrapped by the linker (see test/CMakeLists.txt)
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t cnt, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+void* __real_aligned_alloc(size_t alignment, size_t size);
+
+static size_t allocations_cnt = 0;
+
+void* __wrap_malloc(size_t size) {
+    ++allocations_cnt;
+    return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t cnt, size_t size) {
+    ++allocations_cnt;
+    return __real_calloc(cnt, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+    ++allocations_cnt;
+    return __real_realloc(ptr, size);
+}
+
+void* __wrap_aligned_alloc(size_t alignment, size_t size) {
+    ++allocations_cnt;
+    return __real_aligned_alloc(alignment, size);
+}
+
+#define TEST_WRAPPER(_rs, _engine, _symbol_size, _k, _r, _t)                                                           \
+    do {                                                                                                               \
+        rs_set_engine((_rs), (_engine));                                                                               \
+        if (test((_rs), (_symbol_size), (_k), (_r), (_t))) {                                                           \
+            rs_destroy((_rs));                                                                                         \
+            return 1;                                                                                                  \
+        }                                                                                                              \
+    } while (0)
+
+static int test(RS_t* rs, size_t symbol_size, uint16_t k, uint16_t r, uint16_t t) {
+    assert(t <= r);
+
+    symbol_seq_t* src_symbols;
+    symbol_seq_t* rcv_symbols;
+    symbol_seq_t inf_symbols;
+    symbol_seq_t rep_symbols;
+    symbol_seq_t rcv_inf_symbols;
+    bool* is_erased;
+    int err = 0;
+
+    src_symbols = seq_create(k + r, symbol_size);
+    rcv_symbols = seq_create(k + r, symbol_size);
+    is_erased = (bool*)calloc(k + r, sizeof(bool));
+    if (!src_symbols || !rcv_symbols || !is_erased) {
+        printf("ERROR: couldn't allocate symbols\n");
+        err = 1;
+        goto cleanup;
+    }
+
+    inf_symbols.symbol_size = symbol_size;
+    inf_symbols.length = k;
+    inf_symbols.symbols = src_symbols->symbols;
+
+    rep_symbols.symbol_size = symbol_size;
+    rep_symbols.length = r;
+    rep_symbols.symbols = src_symbols->symbols + k;
+
+    rcv_inf_symbols.symbol_size = symbol_size;
+    rcv_inf_symbols.length = k;
+    rcv_inf_symbols.symbols = rcv_symbols->symbols;
+
+    util_generate_inf_symbols(&inf_symbols);
+    util_choose_and_erase_symbols(rcv_symbols, t, is_erased);
+
+    for (int _i = 0; _i < WARMUP_CNT + ITERATIONS_CNT; ++_i) {
+        size_t cnt = allocations_cnt;
+
+        err = rs_generate_repair_symbols(rs, &inf_symbols, &rep_symbols);
+        if (err) {
+            printf("ERROR: rs_generate_repair_symbols returned %d\n", err);
+            goto cleanup;
+        }
+
+        util_init_rcv_symbols(src_symbols, rcv_symbols);
+        util_corrupt_erased_symbols(rcv_symbols, is_erased);
+
+        err = rs_restore_symbols(rs, k, r, rcv_symbols, is_erased, t);
+        if (err) {
+            printf("ERROR: rs_restore_symbols returned %d\n", err);
+            goto cleanup;
+        }
+
+        if (!seq_eq(&inf_symbols, &rcv_inf_symbols)) {
+            printf("ERROR: inf_symbols != rcv_inf_symbols after restore\n");
+            err = 1;
+            goto cleanup;
+        }
+
+        if (_i >= WARMUP_CNT && allocations_cnt != cnt) {
+            printf("ERROR: engine %d, k = %u, r = %u, t = %u: %zu allocations in steady state\n", (int)rs->engine, k,
+                   r, t, allocations_cnt - cnt);
+            err = 1;
+            goto cleanup;
+        }
+    }
+
+cleanup:
+    free(is_erased);
+    if (rcv_symbols)
+        seq_destroy(rcv_symbols);
+    if (src_symbols)
+        seq_destroy(src_symbols);
+
+    return err;
+}
+
+int main(void) {
+    RS_t* rs;
+
+    rs = rs_create();
+    if (!rs) {
+        printf("ERROR: rs_create returned NULL\n");
+        return 1;
+    }
+
+    srand(SEED);
+
+    TEST_WRAPPER(rs, RS_ENGINE_CYCLOTOMIC, 1024, 200, 50, 50);
+    TEST_WRAPPER(rs, RS_ENGINE_CYCLOTOMIC, 16, 1000, 300, 170);
+    TEST_WRAPPER(rs, RS_ENGINE_ADDITIVE, 1024, 200, 50, 50);
+    TEST_WRAPPER(rs, RS_ENGINE_ADDITIVE, 16, 1000, 300, 170);
+
+    rs_destroy(rs);
+
+    return 0;
+}
@@ -76,4 +76,16 @@ void util_choose_and_erase_symbols(symbol_seq_t* rcv_symbols, uint16_t t, bool*
             continue;
         memset((void*)rcv_symbols->symbols[i]->data, 0, symbol_size);
     }
-}
\ No newline at end of file
+}
+
+void util_corrupt_erased_symbols(symbol_seq_t* rcv_symbols, const bool* is_erased) {
+    size_t symbol_size = rcv_symbols->symbol_size;
+    size_t length = rcv_symbols->length;
+
+    for (size_t i = 0; i < length; ++i) {
+        if (!is_erased[i])
+            continue;
+        for (size_t j = 0; j < symbol_size; ++j)
+            rcv_symbols->symbols[i]->data[j] = (uint8_t)rand();
+    }
+}